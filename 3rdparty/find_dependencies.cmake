@@ -258,6 +258,30 @@ if(WITH_OPENMP)
     endif()
 endif()
 
+# BLAS
+if(WITH_BLAS)
+    find_package(BLAS)
+    find_path(CBLAS_INCLUDE_DIR NAMES cblas.h PATH_SUFFIXES openblas)
+    if(BLAS_FOUND AND CBLAS_INCLUDE_DIR)
+        message(STATUS "Building with BLAS")
+        add_library(3rdparty_blas INTERFACE)
+        target_include_directories(3rdparty_blas INTERFACE ${CBLAS_INCLUDE_DIR})
+        target_link_libraries(3rdparty_blas INTERFACE ${BLAS_LIBRARIES})
+        target_compile_definitions(3rdparty_blas INTERFACE WITH_BLAS)
+        if(NOT BUILD_SHARED_LIBS)
+            install(TARGETS 3rdparty_blas EXPORT ${PROJECT_NAME}Targets
+            RUNTIME DESTINATION ${Open3D_INSTALL_BIN_DIR}
+            ARCHIVE DESTINATION ${Open3D_INSTALL_LIB_DIR}
+            LIBRARY DESTINATION ${Open3D_INSTALL_LIB_DIR}
+        )
+        endif()
+        set(BLAS_TARGET "3rdparty_blas")
+        list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS "${BLAS_TARGET}")
+    else()
+        message(STATUS "BLAS with cblas.h not found, using built-in GEMM")
+    endif()
+endif()
+
 # Dirent
 if(WIN32)
     message(STATUS "Building library 3rdparty_dirent from source (WIN32)")
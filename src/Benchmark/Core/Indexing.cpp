@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace open3d {
+
+static Tensor RandomRowIndex(int64_t num_indices, int64_t num_rows) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(0, num_rows - 1);
+    std::vector<int64_t> index(num_indices);
+    for (int64_t& i : index) {
+        i = dist(rng);
+    }
+    return Tensor(index, {num_indices}, Dtype::Int64, Device("CPU:0"));
+}
+
+static void IndexGetRowsCPU(benchmark::State& state) {
+    // E.g. selecting points of a point cloud by index.
+    Device device("CPU:0");
+    int64_t num_points = 1000000;
+    Tensor points = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor index = RandomRowIndex(num_points / 2, num_points);
+    Tensor warm_up = points.IndexGet({index});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = points.IndexGet({index});
+    }
+}
+
+static void IndexSetRowsCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    int64_t num_points = 1000000;
+    Tensor points = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor index = RandomRowIndex(num_points / 2, num_points);
+    Tensor values = Tensor::Zeros({num_points / 2, 3}, Dtype::Float32, device);
+    for (auto _ : state) {
+        points.IndexSet({index}, values);
+    }
+}
+
+static void IndexAddCPU(benchmark::State& state) {
+    // E.g. accumulating point coordinates per voxel.
+    Device device("CPU:0");
+    int64_t num_points = 1000000;
+    Tensor points = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor index = RandomRowIndex(num_points, state.range(0));
+    Tensor sums = Tensor::Zeros({state.range(0), 3}, Dtype::Float32, device);
+    for (auto _ : state) {
+        sums.IndexAdd_(0, index, points);
+    }
+}
+
+static void IndexGetBoolMaskCPU(benchmark::State& state) {
+    // E.g. filtering points by depth range.
+    Device device("CPU:0");
+    int64_t num_points = 1000000;
+    std::vector<float> depth(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        depth[i] = static_cast<float>(i % 100);
+    }
+    Tensor points = Tensor::Ones({num_points, 3}, Dtype::Float32, device);
+    Tensor mask = Tensor(depth, {num_points}, Dtype::Float32, device)
+                          .Lt(Tensor::Full({}, 50.0, Dtype::Float32, device));
+    Tensor warm_up = points.IndexGet({mask});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = points.IndexGet({mask});
+    }
+}
+
+BENCHMARK(IndexGetRowsCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(IndexSetRowsCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(IndexGetBoolMaskCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(IndexAddCPU)
+        ->Arg(1000)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+static void MatmulCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    int64_t n = state.range(0);
+    Tensor lhs = Tensor::Ones({n, n}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({n, n}, Dtype::Float32, device);
+    Tensor warm_up = lhs.Matmul(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Matmul(rhs);
+    }
+}
+
+static void MatmulBatched3x3CPU(benchmark::State& state) {
+    // E.g. rotating a batch of 3x3 covariance matrices.
+    Device device("CPU:0");
+    Tensor lhs = Tensor::Ones({1000000, 3, 3}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({3, 3}, Dtype::Float32, device);
+    Tensor warm_up = lhs.Matmul(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Matmul(rhs);
+    }
+}
+
+static void InverseBatched4x4CPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({100000, 4, 4}, Dtype::Float64, device);
+    for (int64_t i = 0; i < 4; ++i) {
+        src.Slice(1, i, i + 1).Slice(2, i, i + 1) += 4.0;
+    }
+    Tensor warm_up = src.Inverse();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Inverse();
+    }
+}
+
+static void SVDBatched3x3CPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({100000, 3, 3}, Dtype::Float32, device);
+    Tensor warm_up = std::get<0>(src.SVD());
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor u, s, v;
+        std::tie(u, s, v) = src.SVD();
+    }
+}
+
+BENCHMARK(MatmulCPU)
+        ->Arg(64)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(MatmulBatched3x3CPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(InverseBatched4x4CPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(SVDBatched3x3CPU)->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
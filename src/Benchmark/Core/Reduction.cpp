@@ -52,6 +52,31 @@ static void ReductionCPU(benchmark::State& state) {
 // https://github.com/google/benchmark/issues/498
 BENCHMARK(ReductionCPU)->Unit(benchmark::kMillisecond);
 
+static void ReductionPointsSumCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{10000000, 3};
+    Tensor src = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = src.Sum({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({0});
+    }
+}
+
+static void ReductionArgMaxCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{30000000};
+    Tensor src = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = src.ArgMax({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.ArgMax({0});
+    }
+}
+
+BENCHMARK(ReductionPointsSumCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionArgMaxCPU)->Unit(benchmark::kMillisecond);
+
 #ifdef BUILD_CUDA_MODULE
 
 static void ReductionCUDA(benchmark::State& state) {
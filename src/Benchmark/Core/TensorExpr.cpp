@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Core/TensorExpr.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+// (a - b) * c + d, evaluated one op at a time.
+static void TensorExprEagerCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{10000000, 3};
+    Tensor a = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor b = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor c = Tensor::Ones({3}, Dtype::Float32, device);
+    Tensor d = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = (a - b) * c + d;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = (a - b) * c + d;
+    }
+}
+
+// (a - b) * c + d, fused into a single kernel.
+static void TensorExprFusedCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{10000000, 3};
+    Tensor a = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor b = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor c = Tensor::Ones({3}, Dtype::Float32, device);
+    Tensor d = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = ((TensorExpr(a) - b) * c + d).Eval();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = ((TensorExpr(a) - b) * c + d).Eval();
+    }
+}
+
+BENCHMARK(TensorExprEagerCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(TensorExprFusedCPU)->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
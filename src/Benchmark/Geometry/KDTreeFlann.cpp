@@ -25,8 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeFloat.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/VoxelHashNeighborSearch.h"
 #include "benchmark/benchmark.h"
 
 using namespace Eigen;
@@ -94,3 +96,148 @@ BENCHMARK(BM_TestKDTreeLine0)->Args({1 << 5, 1 << 10})->Args({1 << 9, 1 << 11});
 BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
+
+// Nearest-neighbor search of every point of a random cloud against another
+// one, as done in ICP correspondence search.
+class TestKDTreeBatch {
+    geometry::PointCloud target_;
+    geometry::PointCloud source_;
+    geometry::KDTreeFlann kdtree_;
+    geometry::KDTreeFloat3D kdtree_float_;
+    int size_ = 0;
+
+public:
+    void setup(int size) {
+        if (this->size_ == size) return;
+        this->size_ = size;
+        target_.points_.resize(size);
+        source_.points_.resize(size);
+        for (int i = 0; i < size; ++i) {
+            target_.points_[i] = Vector3d::Random();
+            source_.points_[i] = Vector3d::Random();
+        }
+        kdtree_.SetGeometry(target_);
+        kdtree_float_.SetGeometry(target_);
+    }
+
+    void searchSingle(double radius, int max_nn) {
+        vector<int> indices;
+        vector<double> distance2;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) private(indices, distance2)
+#endif
+        for (int i = 0; i < size_; ++i) {
+            kdtree_.SearchHybrid(source_.points_[i], radius, max_nn, indices,
+                                 distance2);
+        }
+    }
+
+    void searchBatch(double radius, int max_nn) {
+        vector<int> indices;
+        vector<double> distance2;
+        vector<size_t> offsets;
+        kdtree_.SearchHybridBatch(source_.points_, radius, max_nn, indices,
+                                  distance2, offsets);
+        benchmark::DoNotOptimize(indices.data());
+    }
+
+    void searchBatchFloat(double radius, int max_nn) {
+        vector<int> indices;
+        vector<double> distance2;
+        vector<size_t> offsets;
+        kdtree_float_.SearchBatch(source_.points_,
+                                  geometry::KDTreeSearchParamHybrid(radius,
+                                                                    max_nn),
+                                  indices, distance2, offsets);
+        benchmark::DoNotOptimize(indices.data());
+    }
+};
+TestKDTreeBatch testKDTreeBatch;
+
+static void BM_TestKDTreeHybridSingle(benchmark::State& state) {
+    testKDTreeBatch.setup(state.range(0));
+    for (auto _ : state) {
+        testKDTreeBatch.searchSingle(0.05, state.range(1));
+    }
+}
+static void BM_TestKDTreeHybridBatch(benchmark::State& state) {
+    testKDTreeBatch.setup(state.range(0));
+    for (auto _ : state) {
+        testKDTreeBatch.searchBatch(0.05, state.range(1));
+    }
+}
+BENCHMARK(BM_TestKDTreeHybridSingle)
+        ->Args({1 << 17, 1})
+        ->Args({1 << 17, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeHybridBatch)
+        ->Args({1 << 17, 1})
+        ->Args({1 << 17, 30})
+        ->Unit(benchmark::kMillisecond);
+
+static void BM_TestKDTreeFloatHybridBatch(benchmark::State& state) {
+    testKDTreeBatch.setup(state.range(0));
+    for (auto _ : state) {
+        testKDTreeBatch.searchBatchFloat(0.05, state.range(1));
+    }
+}
+BENCHMARK(BM_TestKDTreeFloatHybridBatch)
+        ->Args({1 << 17, 1})
+        ->Args({1 << 17, 30})
+        ->Unit(benchmark::kMillisecond);
+
+// Fixed-radius neighborhoods of every point of a random cloud, index build
+// included, as done by outlier removal and clustering.
+class TestFixedRadiusAll {
+    geometry::PointCloud pc_;
+    int size_ = 0;
+
+public:
+    void setup(int size) {
+        if (this->size_ == size) return;
+        this->size_ = size;
+        pc_.points_.resize(size);
+        for (int i = 0; i < size; ++i) {
+            pc_.points_[i] = Vector3d::Random();
+        }
+    }
+
+    void searchKDTree(double radius) {
+        vector<int> indices;
+        vector<double> distance2;
+        vector<size_t> offsets;
+        geometry::KDTreeFlann kdtree(pc_);
+        kdtree.SearchRadiusBatch(pc_.points_, radius, indices, distance2,
+                                 offsets);
+        benchmark::DoNotOptimize(indices.data());
+    }
+
+    void searchVoxelHash(double radius) {
+        vector<int> indices;
+        vector<double> distance2;
+        vector<size_t> offsets;
+        geometry::VoxelHashNeighborSearch grid(pc_.points_, radius);
+        grid.SearchRadiusAll(radius, indices, distance2, offsets);
+        benchmark::DoNotOptimize(indices.data());
+    }
+};
+TestFixedRadiusAll testFixedRadiusAll;
+
+static void BM_TestFixedRadiusAllKDTree(benchmark::State& state) {
+    testFixedRadiusAll.setup(state.range(0));
+    for (auto _ : state) {
+        testFixedRadiusAll.searchKDTree(0.05);
+    }
+}
+static void BM_TestFixedRadiusAllVoxelHash(benchmark::State& state) {
+    testFixedRadiusAll.setup(state.range(0));
+    for (auto _ : state) {
+        testFixedRadiusAll.searchVoxelHash(0.05);
+    }
+}
+BENCHMARK(BM_TestFixedRadiusAllKDTree)
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestFixedRadiusAllVoxelHash)
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
@@ -26,6 +26,8 @@
 
 #include "Open3D/Core/AdvancedIndexing.h"
 
+#include <algorithm>
+
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
@@ -55,6 +57,34 @@ bool AdvancedIndexPreprocessor::IsIndexSplittedBySlice(
     return false;
 }
 
+std::vector<Tensor> AdvancedIndexPreprocessor::ExpandBoolTensors(
+        const Tensor& tensor, const std::vector<Tensor>& index_tensors) {
+    std::vector<Tensor> expanded_tensors;
+    for (const Tensor& index_tensor : index_tensors) {
+        if (index_tensor.GetDtype() != Dtype::Bool) {
+            expanded_tensors.push_back(index_tensor);
+            continue;
+        }
+        int64_t dim_begin = expanded_tensors.size();
+        int64_t num_mask_dims = index_tensor.NumDims();
+        SizeVector mask_shape = index_tensor.GetShape();
+        if (num_mask_dims == 0 ||
+            dim_begin + num_mask_dims > tensor.NumDims() ||
+            !std::equal(mask_shape.begin(), mask_shape.end(),
+                        tensor.GetShape().begin() + dim_begin)) {
+            utility::LogError(
+                    "Boolean index of shape {} does not match the tensor "
+                    "shape {} at dimension {}.",
+                    mask_shape.ToString(), tensor.GetShape().ToString(),
+                    dim_begin);
+        }
+        for (const Tensor& indices : index_tensor.NonZeroNumpy()) {
+            expanded_tensors.push_back(indices);
+        }
+    }
+    return expanded_tensors;
+}
+
 std::pair<Tensor, std::vector<Tensor>>
 AdvancedIndexPreprocessor::ShuffleIndexedDimsToFront(
         const Tensor& tensor, const std::vector<Tensor>& index_tensors) {
@@ -134,9 +164,10 @@ void AdvancedIndexPreprocessor::RunPreprocess() {
                 index_tensors_.size(), tensor_.NumDims());
     }
 
+    // Boolean index tensors are converted to int64 index tensors.
+    index_tensors_ = ExpandBoolTensors(tensor_, index_tensors_);
+
     // Index tensors must be using int64.
-    // Boolean indexing tensors will be supported in the future by
-    // converting to int64_t tensors.
     for (const Tensor& index_tensor : index_tensors_) {
         if (index_tensor.GetDtype() != Dtype::Int64) {
             utility::LogError(
@@ -57,6 +57,14 @@ public:
 
     inline SizeVector GetIndexedStrides() const { return indexed_strides_; }
 
+    /// Replaces each Bool index tensor (mask) by the Int64 indices of its
+    /// non-zero elements, one index tensor per mask dimension. A mask must
+    /// have the same shape as the dimensions of \p tensor it covers.
+    /// E.g. A[mask] with A.shape == [5, 3] and mask.shape == [5] is converted
+    /// to A[mask.NonZeroNumpy()[0]].
+    static std::vector<Tensor> ExpandBoolTensors(
+            const Tensor& tensor, const std::vector<Tensor>& index_tensors);
+
     /// Returns true if the indexed dimension is splitted by (full) slice.
     /// E.g. A[[1, 2], :, [1, 2]] returns true
     ///      A[[1, 2], [1, 2], :] returns false
@@ -27,7 +27,9 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "Open3D/Core/Device.h"
@@ -40,7 +42,8 @@ namespace open3d {
 /// Usually a Blob is constructed by specifying the blob size and device, memory
 /// allocation happens during the Blob's construction.
 ///
-/// A Blob's buffer can also be managed by an external memory manager. In this
+/// A Blob's buffer can also be managed by an external memory manager, or be a
+/// non-owning view of memory owned by another container. In the former
 /// case, a deleter function is needed to notify the external memory manager
 /// that the memory is no longer needed. It does not make sense to infer the
 /// total buffer size. For example, if a Tensor has a negative stride size, it
@@ -75,6 +78,21 @@ public:
          const std::function<void(void*)>& deleter)
         : deleter_(deleter), data_ptr_(data_ptr), device_(device) {}
 
+    /// Construct a non-owning Blob viewing memory owned by someone else, e.g.
+    /// the buffer of a std::vector. The memory is never freed by the Blob.
+    ///
+    /// \param device Device where the blob resides.
+    /// \param data_ptr Pointer the blob's beginning.
+    /// \param keepalive Optional owner of the memory. The Blob holds a
+    /// reference to it until destruction, so that the owner outlives all
+    /// Tensors viewing the memory.
+    Blob(const Device& device,
+         void* data_ptr,
+         const std::shared_ptr<void>& keepalive)
+        : deleter_([keepalive](void*) {}),
+          data_ptr_(data_ptr),
+          device_(device) {}
+
     ~Blob() {
         if (deleter_) {
             // Our custom deleter's void* argument is not used. The deleter
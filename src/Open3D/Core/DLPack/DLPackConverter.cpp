@@ -61,12 +61,18 @@ DLManagedTensor* ToDLPack(const Tensor& t) {
 
     DLDataType dl_data_type;
     switch (t.GetDtype()) {
+        case Dtype::Float16:
+            dl_data_type.code = DLDataTypeCode::kDLFloat;
+            break;
         case Dtype::Float32:
             dl_data_type.code = DLDataTypeCode::kDLFloat;
             break;
         case Dtype::Float64:
             dl_data_type.code = DLDataTypeCode::kDLFloat;
             break;
+        case Dtype::Int16:
+            dl_data_type.code = DLDataTypeCode::kDLInt;
+            break;
         case Dtype::Int32:
             dl_data_type.code = DLDataTypeCode::kDLInt;
             break;
@@ -76,6 +82,9 @@ DLManagedTensor* ToDLPack(const Tensor& t) {
         case Dtype::UInt8:
             dl_data_type.code = DLDataTypeCode::kDLUInt;
             break;
+        case Dtype::UInt16:
+            dl_data_type.code = DLDataTypeCode::kDLUInt;
+            break;
         default:
             utility::LogError("Unsupported data type");
     }
@@ -132,6 +141,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
                 case 8:
                     dtype = Dtype::UInt8;
                     break;
+                case 16:
+                    dtype = Dtype::UInt16;
+                    break;
                 default:
                     utility::LogError("Unsupported kDLUInt bits {}",
                                       src->dl_tensor.dtype.bits);
@@ -139,6 +151,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLInt:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Int16;
+                    break;
                 case 32:
                     dtype = Dtype::Int32;
                     break;
@@ -152,6 +167,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
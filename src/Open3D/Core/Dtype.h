@@ -29,6 +29,7 @@
 #include "string"
 
 #include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Float16.h"
 #include "Open3D/Utility/Console.h"
 
 static_assert(sizeof(float) == 4,
@@ -36,6 +37,10 @@ static_assert(sizeof(float) == 4,
 static_assert(sizeof(double) == 8,
               "Unsupported platform: double must be 8 bytes");
 static_assert(sizeof(int) == 4, "Unsupported platform: int must be 4 bytes");
+static_assert(sizeof(int16_t) == 2,
+              "Unsupported platform: int16_t must be 2 bytes");
+static_assert(sizeof(uint16_t) == 2,
+              "Unsupported platform: uint16_t must be 2 bytes");
 static_assert(sizeof(int32_t) == 4,
               "Unsupported platform: int32_t must be 4 bytes");
 static_assert(sizeof(int64_t) == 8,
@@ -48,11 +53,14 @@ namespace open3d {
 
 enum class Dtype {
     Undefined,  // Dtype for uninitialized Tensor
+    Float16,    // Half precision storage, computed in float32
     Float32,
     Float64,
+    Int16,
     Int32,
     Int64,
     UInt8,
+    UInt16,
     Bool,
 };
 
@@ -61,12 +69,18 @@ public:
     static int64_t ByteSize(const Dtype &dtype) {
         int64_t byte_size = 0;
         switch (dtype) {
+            case Dtype::Float16:
+                byte_size = 2;
+                break;
             case Dtype::Float32:
                 byte_size = 4;
                 break;
             case Dtype::Float64:
                 byte_size = 8;
                 break;
+            case Dtype::Int16:
+                byte_size = 2;
+                break;
             case Dtype::Int32:
                 byte_size = 4;
                 break;
@@ -76,6 +90,9 @@ public:
             case Dtype::UInt8:
                 byte_size = 1;
                 break;
+            case Dtype::UInt16:
+                byte_size = 2;
+                break;
             case Dtype::Bool:
                 byte_size = 1;
                 break;
@@ -100,12 +117,18 @@ public:
             case Dtype::Undefined:
                 str = "Undefined";
                 break;
+            case Dtype::Float16:
+                str = "Float16";
+                break;
             case Dtype::Float32:
                 str = "Float32";
                 break;
             case Dtype::Float64:
                 str = "Float64";
                 break;
+            case Dtype::Int16:
+                str = "Int16";
+                break;
             case Dtype::Int32:
                 str = "Int32";
                 break;
@@ -115,6 +138,9 @@ public:
             case Dtype::UInt8:
                 str = "UInt8";
                 break;
+            case Dtype::UInt16:
+                str = "UInt16";
+                break;
             case Dtype::Bool:
                 str = "Bool";
                 break;
@@ -125,6 +151,11 @@ public:
     }
 };
 
+template <>
+inline Dtype DtypeUtil::FromType<Float16>() {
+    return Dtype::Float16;
+}
+
 template <>
 inline Dtype DtypeUtil::FromType<float>() {
     return Dtype::Float32;
@@ -135,6 +166,11 @@ inline Dtype DtypeUtil::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline Dtype DtypeUtil::FromType<int16_t>() {
+    return Dtype::Int16;
+}
+
 template <>
 inline Dtype DtypeUtil::FromType<int32_t>() {
     return Dtype::Int32;
@@ -150,6 +186,11 @@ inline Dtype DtypeUtil::FromType<uint8_t>() {
     return Dtype::UInt8;
 }
 
+template <>
+inline Dtype DtypeUtil::FromType<uint16_t>() {
+    return Dtype::UInt16;
+}
+
 template <>
 inline Dtype DtypeUtil::FromType<bool>() {
     return Dtype::Bool;
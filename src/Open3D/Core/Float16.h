@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+/// IEEE 754 half-precision floating point number, used as the storage type of
+/// Dtype::Float16 Tensors.
+///
+/// Float16 only stores the 16 bits. It converts implicitly to and from float,
+/// so arithmetic, comparisons and math functions on Float16 values are
+/// computed in float32 and rounded back to half precision (round to nearest
+/// even) when stored.
+struct Float16 {
+    Float16() = default;
+
+    OPEN3D_HOST_DEVICE Float16(float value) : bits_(FloatToBits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    OPEN3D_HOST_DEVICE Float16& operator+=(float value) {
+        return *this = Float16(float(*this) + value);
+    }
+    OPEN3D_HOST_DEVICE Float16& operator-=(float value) {
+        return *this = Float16(float(*this) - value);
+    }
+    OPEN3D_HOST_DEVICE Float16& operator*=(float value) {
+        return *this = Float16(float(*this) * value);
+    }
+    OPEN3D_HOST_DEVICE Float16& operator/=(float value) {
+        return *this = Float16(float(*this) / value);
+    }
+
+    /// Creates a Float16 from its raw IEEE 754 bits.
+    OPEN3D_HOST_DEVICE static Float16 FromBits(uint16_t bits) {
+        Float16 h;
+        h.bits_ = bits;
+        return h;
+    }
+
+    /// Rounds \p value to the nearest half, ties to even. Values beyond the
+    /// half range become infinity and NaNs stay NaN.
+    ///
+    /// Ref: https://gist.github.com/rygorous/2156668
+    OPEN3D_HOST_DEVICE static uint16_t FloatToBits(float value) {
+        uint32_t f;
+        memcpy(&f, &value, sizeof(f));
+        uint32_t sign = f & 0x80000000u;
+        f ^= sign;
+
+        uint16_t h;
+        if (f >= 0x47800000u) {
+            // Beyond the half range: infinity, or a quiet NaN.
+            h = f > 0x7f800000u ? 0x7e00 : 0x7c00;
+        } else if (f < 0x38800000u) {
+            // Subnormal half or zero. Adding 0.5 aligns the 10 mantissa bits
+            // at the bottom of the float and rounds to nearest even.
+            float magic;
+            uint32_t magic_bits = 0x3f000000u;
+            memcpy(&magic, &magic_bits, sizeof(magic));
+            float shifted;
+            memcpy(&shifted, &f, sizeof(shifted));
+            shifted += magic;
+            memcpy(&f, &shifted, sizeof(f));
+            h = static_cast<uint16_t>(f - magic_bits);
+        } else {
+            // Normal half. Rebias the exponent and round to nearest even.
+            uint32_t mantissa_odd = (f >> 13) & 1;
+            f += 0xc8000fffu + mantissa_odd;
+            h = static_cast<uint16_t>(f >> 13);
+        }
+        return h | static_cast<uint16_t>(sign >> 16);
+    }
+
+    /// Converts half bits to float, which is exact.
+    OPEN3D_HOST_DEVICE static float BitsToFloat(uint16_t bits) {
+        uint32_t f = static_cast<uint32_t>(bits & 0x7fff) << 13;
+        uint32_t exponent = f & 0x0f800000u;
+        f += 0x38000000u;
+        if (exponent == 0x0f800000u) {
+            // Infinity or NaN.
+            f += 0x38000000u;
+        } else if (exponent == 0) {
+            // Zero or subnormal: renormalize.
+            f += 0x00800000u;
+            float renormalized;
+            memcpy(&renormalized, &f, sizeof(renormalized));
+            renormalized -= 6.103515625e-05f;  // 2^-14
+            memcpy(&f, &renormalized, sizeof(f));
+        }
+        f |= static_cast<uint32_t>(bits & 0x8000) << 16;
+        float value;
+        memcpy(&value, &f, sizeof(value));
+        return value;
+    }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Float16) == 2, "Float16 must be 2 bytes");
+
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::Float16> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int max_exponent = 16;
+
+    static open3d::Float16 min() { return open3d::Float16::FromBits(0x0400); }
+    static open3d::Float16 lowest() {
+        return open3d::Float16::FromBits(0xfbff);
+    }
+    static open3d::Float16 max() { return open3d::Float16::FromBits(0x7bff); }
+    static open3d::Float16 epsilon() {
+        return open3d::Float16::FromBits(0x1400);
+    }
+    static open3d::Float16 infinity() {
+        return open3d::Float16::FromBits(0x7c00);
+    }
+    static open3d::Float16 quiet_NaN() {
+        return open3d::Float16::FromBits(0x7e00);
+    }
+    static open3d::Float16 denorm_min() {
+        return open3d::Float16::FromBits(0x0001);
+    }
+};
+
+}  // namespace std
+
+namespace fmt {
+
+template <>
+struct formatter<open3d::Float16> : formatter<float> {
+    template <typename FormatContext>
+    auto format(const open3d::Float16& value, FormatContext& ctx)
+            -> decltype(ctx.out()) {
+        return formatter<float>::format(static_cast<float>(value), ctx);
+    }
+};
+
+}  // namespace fmt
@@ -528,6 +528,17 @@ void Indexer::UpdateMasterStrides() {
     }
 }
 
+bool Indexer::IsTensorRefLinear(const TensorRef& tr, bool contiguous) const {
+    int64_t element_byte_stride = contiguous ? tr.dtype_byte_size_ : 0;
+    for (int64_t i = 0; i < ndims_; ++i) {
+        if (master_shape_[i] > 1 &&
+            tr.byte_strides_[i] != master_strides_[i] * element_byte_stride) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Indexer::BroadcastRestride(TensorRef& src,
                                 int64_t dst_ndims,
                                 const int64_t* dst_shape) {
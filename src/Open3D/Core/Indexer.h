@@ -346,6 +346,25 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns true if the \p input_idx -th input is contiguous in the master
+    /// shape, i.e. GetInputPtr(input_idx, workload_idx) ==
+    /// GetInputPtr(input_idx, 0) + workload_idx * element_byte_size.
+    bool IsInputContiguous(int64_t input_idx) const {
+        return IsTensorRefLinear(GetInput(input_idx), true);
+    }
+
+    /// Returns true if the \p input_idx -th input is a broadcasted scalar,
+    /// i.e. all workloads point to the same input element.
+    bool IsInputScalar(int64_t input_idx) const {
+        return IsTensorRefLinear(GetInput(input_idx), false);
+    }
+
+    /// Returns true if the \p output_idx -th output is contiguous in the
+    /// master shape. See IsInputContiguous.
+    bool IsOutputContiguous(int64_t output_idx = 0) const {
+        return IsTensorRefLinear(GetOutput(output_idx), true);
+    }
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
@@ -392,6 +411,11 @@ protected:
     /// Update master_strides_ based on master_shape_.
     void UpdateMasterStrides();
 
+    /// Returns true if \p tr 's byte strides are the master strides scaled by
+    /// the element byte size (\p contiguous == true), or are all 0 (\p
+    /// contiguous == false), ignoring dimensions of size 1.
+    bool IsTensorRefLinear(const TensorRef& tr, bool contiguous) const;
+
     /// Broadcast src to dst by setting shape 1 to omitted dimensions and
     /// setting stride 0 to brocasted dimensions.
     ///
@@ -28,6 +28,7 @@
 
 #include <vector>
 
+#include "Open3D/Core/KernelProfiler.h"
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -44,6 +45,39 @@ const std::unordered_set<BinaryEWOpCode, utility::hash_enum_class::hash>
                 BinaryEWOpCode::Ne,
         };
 
+static const char* GetBinaryEWOpName(BinaryEWOpCode op_code) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            return "BinaryEW::Add";
+        case BinaryEWOpCode::Sub:
+            return "BinaryEW::Sub";
+        case BinaryEWOpCode::Mul:
+            return "BinaryEW::Mul";
+        case BinaryEWOpCode::Div:
+            return "BinaryEW::Div";
+        case BinaryEWOpCode::LogicalAnd:
+            return "BinaryEW::LogicalAnd";
+        case BinaryEWOpCode::LogicalOr:
+            return "BinaryEW::LogicalOr";
+        case BinaryEWOpCode::LogicalXor:
+            return "BinaryEW::LogicalXor";
+        case BinaryEWOpCode::Gt:
+            return "BinaryEW::Gt";
+        case BinaryEWOpCode::Lt:
+            return "BinaryEW::Lt";
+        case BinaryEWOpCode::Ge:
+            return "BinaryEW::Ge";
+        case BinaryEWOpCode::Le:
+            return "BinaryEW::Le";
+        case BinaryEWOpCode::Eq:
+            return "BinaryEW::Eq";
+        case BinaryEWOpCode::Ne:
+            return "BinaryEW::Ne";
+        default:
+            return "BinaryEW";
+    }
+}
+
 void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
@@ -67,6 +101,8 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    KernelProfileScope profile_scope(GetBinaryEWOpName(op_code), lhs, rhs,
+                                     dst);
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
@@ -132,39 +132,39 @@ static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
                                         const Indexer& indexer) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            CPULauncher::LaunchBinaryEWKernel(
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
                     indexer, CPULogicalAndElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::LogicalOr:
-            CPULauncher::LaunchBinaryEWKernel(
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
                     indexer, CPULogicalOrElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::LogicalXor:
-            CPULauncher::LaunchBinaryEWKernel(
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
                     indexer, CPULogicalXorElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Gt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUGtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPUGtElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Lt:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPULtElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPULtElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Ge:
-            CPULauncher::LaunchBinaryEWKernel(
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
                     indexer, CPUGeqElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Le:
-            CPULauncher::LaunchBinaryEWKernel(
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
                     indexer, CPULeqElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Eq:
-            CPULauncher::LaunchBinaryEWKernel(indexer,
-                                              CPUEqElementKernel<src_t, dst_t>);
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPUEqElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Ne:
-            CPULauncher::LaunchBinaryEWKernel(
+            CPULauncher::LaunchBinaryEWKernel<src_t, dst_t>(
                     indexer, CPUNeqElementKernel<src_t, dst_t>);
             break;
         default:
@@ -205,19 +205,19 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    CPULauncher::LaunchBinaryEWKernel(
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUAddElementKernel<scalar_t>);
                     break;
                 case BinaryEWOpCode::Sub:
-                    CPULauncher::LaunchBinaryEWKernel(
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUSubElementKernel<scalar_t>);
                     break;
                 case BinaryEWOpCode::Mul:
-                    CPULauncher::LaunchBinaryEWKernel(
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUMulElementKernel<scalar_t>);
                     break;
                 case BinaryEWOpCode::Div:
-                    CPULauncher::LaunchBinaryEWKernel(
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUDivElementKernel<scalar_t>);
                     break;
                 default:
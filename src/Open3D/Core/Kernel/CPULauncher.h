@@ -27,6 +27,8 @@
 #pragma once
 
 #include <cassert>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "Open3D/Core/AdvancedIndexing.h"
@@ -40,31 +42,55 @@ namespace kernel {
 
 class CPULauncher {
 public:
-    template <typename func_t>
+    /// Launches an unary element-wise kernel, \p src_t and \p dst_t are the
+    /// input and output element types.
+    ///
+    /// If the output is contiguous and the input is either contiguous or a
+    /// broadcasted scalar, the workloads are iterated with typed pointers
+    /// without per-element offset computation, such that \p element_kernel
+    /// can be inlined and vectorized. Otherwise, the offsets are computed once
+    /// per row of the innermost dimension.
+    template <typename src_t, typename dst_t, typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        if (indexer.IsOutputContiguous()) {
+            if (indexer.IsInputContiguous(0)) {
+                LaunchUnaryEWKernelLinear<src_t, dst_t, 1>(indexer,
+                                                           element_kernel);
+                return;
+            } else if (indexer.IsInputScalar(0)) {
+                LaunchUnaryEWKernelLinear<src_t, dst_t, 0>(indexer,
+                                                           element_kernel);
+                return;
+            }
         }
+        LaunchUnaryEWKernelStrided(indexer, element_kernel);
     }
 
-    template <typename func_t>
+    /// Launches a binary element-wise kernel, \p src_t and \p dst_t are the
+    /// input and output element types. See LaunchUnaryEWKernel for the fast
+    /// paths, e.g. `Tensor::Add(T scalar)` takes the broadcasted scalar path.
+    template <typename src_t, typename dst_t, typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        if (indexer.IsOutputContiguous()) {
+            bool lhs_contiguous = indexer.IsInputContiguous(0);
+            bool rhs_contiguous = indexer.IsInputContiguous(1);
+            if (lhs_contiguous && rhs_contiguous) {
+                LaunchBinaryEWKernelLinear<src_t, dst_t, 1, 1>(indexer,
+                                                               element_kernel);
+                return;
+            } else if (lhs_contiguous && indexer.IsInputScalar(1)) {
+                LaunchBinaryEWKernelLinear<src_t, dst_t, 1, 0>(indexer,
+                                                               element_kernel);
+                return;
+            } else if (rhs_contiguous && indexer.IsInputScalar(0)) {
+                LaunchBinaryEWKernelLinear<src_t, dst_t, 0, 1>(indexer,
+                                                               element_kernel);
+                return;
+            }
         }
+        LaunchBinaryEWKernelStrided(indexer, element_kernel);
     }
 
     template <typename func_t>
@@ -162,6 +188,113 @@ public:
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
         }
     }
+
+private:
+    /// \p src_step is 1 for contiguous input and 0 for broadcasted scalar.
+    template <typename src_t, typename dst_t, int64_t src_step, typename func_t>
+    static void LaunchUnaryEWKernelLinear(const Indexer& indexer,
+                                          func_t element_kernel) {
+        const src_t* src =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        int64_t num_workloads = indexer.NumWorkloads();
+#ifdef _OPENMP
+#pragma omp parallel for simd schedule(static)
+#endif
+        for (int64_t i = 0; i < num_workloads; ++i) {
+            element_kernel(src + i * src_step, dst + i);
+        }
+    }
+
+    /// \p lhs_step and \p rhs_step are 1 for contiguous inputs and 0 for
+    /// broadcasted scalars.
+    template <typename src_t,
+              typename dst_t,
+              int64_t lhs_step,
+              int64_t rhs_step,
+              typename func_t>
+    static void LaunchBinaryEWKernelLinear(const Indexer& indexer,
+                                           func_t element_kernel) {
+        const src_t* lhs =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+        const src_t* rhs =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(1, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        int64_t num_workloads = indexer.NumWorkloads();
+#ifdef _OPENMP
+#pragma omp parallel for simd schedule(static)
+#endif
+        for (int64_t i = 0; i < num_workloads; ++i) {
+            element_kernel(lhs + i * lhs_step, rhs + i * rhs_step, dst + i);
+        }
+    }
+
+    template <typename func_t>
+    static void LaunchUnaryEWKernelStrided(const Indexer& indexer,
+                                           func_t element_kernel) {
+        int64_t num_rows, row_size;
+        std::tie(num_rows, row_size) = GetInnerDimRows(indexer);
+        int64_t inner_dim = indexer.NumDims() - 1;
+        int64_t src_byte_stride =
+                inner_dim < 0 ? 0
+                              : indexer.GetInput(0).byte_strides_[inner_dim];
+        int64_t dst_byte_stride =
+                inner_dim < 0 ? 0
+                              : indexer.GetOutput().byte_strides_[inner_dim];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+            const char* src = indexer.GetInputPtr(0, row_idx * row_size);
+            char* dst = indexer.GetOutputPtr(row_idx * row_size);
+            for (int64_t i = 0; i < row_size; ++i) {
+                element_kernel(src + i * src_byte_stride,
+                               dst + i * dst_byte_stride);
+            }
+        }
+    }
+
+    template <typename func_t>
+    static void LaunchBinaryEWKernelStrided(const Indexer& indexer,
+                                            func_t element_kernel) {
+        int64_t num_rows, row_size;
+        std::tie(num_rows, row_size) = GetInnerDimRows(indexer);
+        int64_t inner_dim = indexer.NumDims() - 1;
+        int64_t lhs_byte_stride =
+                inner_dim < 0 ? 0
+                              : indexer.GetInput(0).byte_strides_[inner_dim];
+        int64_t rhs_byte_stride =
+                inner_dim < 0 ? 0
+                              : indexer.GetInput(1).byte_strides_[inner_dim];
+        int64_t dst_byte_stride =
+                inner_dim < 0 ? 0
+                              : indexer.GetOutput().byte_strides_[inner_dim];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+            const char* lhs = indexer.GetInputPtr(0, row_idx * row_size);
+            const char* rhs = indexer.GetInputPtr(1, row_idx * row_size);
+            char* dst = indexer.GetOutputPtr(row_idx * row_size);
+            for (int64_t i = 0; i < row_size; ++i) {
+                element_kernel(lhs + i * lhs_byte_stride,
+                               rhs + i * rhs_byte_stride,
+                               dst + i * dst_byte_stride);
+            }
+        }
+    }
+
+    /// Splits the workloads into rows of the innermost master dimension.
+    /// Within a row, each operand advances by its innermost byte stride.
+    /// Returns {num_rows, row_size}.
+    static std::pair<int64_t, int64_t> GetInnerDimRows(const Indexer& indexer) {
+        int64_t num_workloads = indexer.NumWorkloads();
+        if (indexer.NumDims() == 0 || num_workloads == 0) {
+            return {num_workloads, 1};
+        }
+        int64_t row_size = indexer.GetMasterShape()[indexer.NumDims() - 1];
+        return {num_workloads / row_size, row_size};
+    }
 };
 
 }  // namespace kernel
@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+FusedEWInstruction FusedEWInstruction::MakeInput(int64_t input_idx,
+                                                 Dtype dtype) {
+    FusedEWInstruction instruction;
+    instruction.type_ = Type::Input;
+    instruction.input_idx_ = input_idx;
+    instruction.dtype_ = dtype;
+    return instruction;
+}
+
+FusedEWInstruction FusedEWInstruction::MakeUnary(UnaryEWOpCode op_code,
+                                                 int64_t src,
+                                                 Dtype dtype) {
+    FusedEWInstruction instruction;
+    instruction.type_ = Type::Unary;
+    instruction.unary_op_code_ = op_code;
+    instruction.lhs_ = src;
+    instruction.dtype_ = dtype;
+    return instruction;
+}
+
+FusedEWInstruction FusedEWInstruction::MakeBinary(BinaryEWOpCode op_code,
+                                                  int64_t lhs,
+                                                  int64_t rhs,
+                                                  Dtype dtype) {
+    FusedEWInstruction instruction;
+    instruction.type_ = Type::Binary;
+    instruction.binary_op_code_ = op_code;
+    instruction.lhs_ = lhs;
+    instruction.rhs_ = rhs;
+    instruction.dtype_ = dtype;
+    return instruction;
+}
+
+/// Checks operand indices and dtypes of \p program, such that kernels do not
+/// have to report errors from within parallel regions.
+static void CheckFusedEWProgram(const std::vector<Tensor>& inputs,
+                                const std::vector<FusedEWInstruction>& program,
+                                const Tensor& dst) {
+    if (program.empty()) {
+        utility::LogError("FusedEW: program is empty.");
+    }
+    auto check_operand = [](int64_t operand, int64_t instruction_idx) {
+        if (operand < 0 || operand >= instruction_idx) {
+            utility::LogError(
+                    "FusedEW: instruction {} has invalid operand register {}.",
+                    instruction_idx, operand);
+        }
+    };
+    auto is_float = [](Dtype dtype) {
+        return dtype == Dtype::Float16 || dtype == Dtype::Float32 ||
+               dtype == Dtype::Float64;
+    };
+
+    for (int64_t i = 0; i < static_cast<int64_t>(program.size()); ++i) {
+        const FusedEWInstruction& instruction = program[i];
+        Dtype dtype = instruction.dtype_;
+        if (instruction.type_ == FusedEWInstruction::Type::Input) {
+            int64_t input_idx = instruction.input_idx_;
+            if (input_idx < 0 ||
+                input_idx >= static_cast<int64_t>(inputs.size())) {
+                utility::LogError("FusedEW: invalid input index {}.",
+                                  input_idx);
+            }
+            if (inputs[input_idx].GetDtype() != dtype) {
+                utility::LogError("FusedEW: input {} has dtype {} != {}.",
+                                  input_idx,
+                                  DtypeUtil::ToString(
+                                          inputs[input_idx].GetDtype()),
+                                  DtypeUtil::ToString(dtype));
+            }
+        } else if (instruction.type_ == FusedEWInstruction::Type::Unary) {
+            check_operand(instruction.lhs_, i);
+            Dtype src_dtype = program[instruction.lhs_].dtype_;
+            UnaryEWOpCode op_code = instruction.unary_op_code_;
+            if (op_code == UnaryEWOpCode::LogicalNot) {
+                if (dtype != Dtype::Bool) {
+                    utility::LogError(
+                            "FusedEW: LogicalNot must output Bool, but {} is "
+                            "used.",
+                            DtypeUtil::ToString(dtype));
+                }
+            } else if (dtype != src_dtype || dtype == Dtype::Bool) {
+                utility::LogError("FusedEW: unsupported unary op dtype {}.",
+                                  DtypeUtil::ToString(dtype));
+            } else if ((op_code == UnaryEWOpCode::Sqrt ||
+                        op_code == UnaryEWOpCode::Sin ||
+                        op_code == UnaryEWOpCode::Cos ||
+                        op_code == UnaryEWOpCode::Exp) &&
+                       !is_float(dtype)) {
+                utility::LogError(
+                        "Only supports Float16, Float32 and Float64, but {} "
+                        "is used.",
+                        DtypeUtil::ToString(dtype));
+            }
+        } else {
+            check_operand(instruction.lhs_, i);
+            check_operand(instruction.rhs_, i);
+            Dtype src_dtype = program[instruction.lhs_].dtype_;
+            if (program[instruction.rhs_].dtype_ != src_dtype) {
+                utility::LogError(
+                        "FusedEW: binary op operand dtypes {} and {} differ.",
+                        DtypeUtil::ToString(src_dtype),
+                        DtypeUtil::ToString(program[instruction.rhs_].dtype_));
+            }
+            if (s_boolean_binary_ew_op_codes.count(
+                        instruction.binary_op_code_)) {
+                if (dtype != Dtype::Bool) {
+                    utility::LogError(
+                            "FusedEW: boolean op must output Bool, but {} is "
+                            "used.",
+                            DtypeUtil::ToString(dtype));
+                }
+            } else if (dtype != src_dtype || dtype == Dtype::Bool) {
+                utility::LogError("FusedEW: unsupported binary op dtype {}.",
+                                  DtypeUtil::ToString(dtype));
+            }
+        }
+    }
+
+    if (program.back().dtype_ != dst.GetDtype()) {
+        utility::LogError("FusedEW: result dtype {} != output dtype {}.",
+                          DtypeUtil::ToString(program.back().dtype_),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    CheckFusedEWProgram(inputs, program, dst);
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        if (static_cast<int64_t>(inputs.size()) <= MAX_INPUTS) {
+            FusedEWCPU(inputs, program, dst);
+        } else {
+            FusedEWUnfused(inputs, program, dst);
+        }
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWUnfused(inputs, program, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+void FusedEWUnfused(const std::vector<Tensor>& inputs,
+                    const std::vector<FusedEWInstruction>& program,
+                    Tensor& dst) {
+    std::vector<Tensor> registers;
+    registers.reserve(program.size());
+    for (const FusedEWInstruction& instruction : program) {
+        if (instruction.type_ == FusedEWInstruction::Type::Input) {
+            registers.push_back(inputs[instruction.input_idx_]);
+        } else if (instruction.type_ == FusedEWInstruction::Type::Unary) {
+            const Tensor& src = registers[instruction.lhs_];
+            Tensor result(src.GetShape(), instruction.dtype_, dst.GetDevice());
+            UnaryEW(src, result, instruction.unary_op_code_);
+            registers.push_back(result);
+        } else {
+            const Tensor& lhs = registers[instruction.lhs_];
+            const Tensor& rhs = registers[instruction.rhs_];
+            Tensor result(shape_util::BroadcastedShape(lhs.GetShape(),
+                                                       rhs.GetShape()),
+                          instruction.dtype_, dst.GetDevice());
+            BinaryEW(lhs, rhs, result, instruction.binary_op_code_);
+            registers.push_back(result);
+        }
+    }
+    Copy(registers.back(), dst);
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// One instruction of a fused element-wise program. Instruction i writes
+/// register i. Operands refer to registers of preceding instructions.
+struct FusedEWInstruction {
+    enum class Type { Input, Unary, Binary };
+
+    static FusedEWInstruction MakeInput(int64_t input_idx, Dtype dtype);
+    static FusedEWInstruction MakeUnary(UnaryEWOpCode op_code,
+                                        int64_t src,
+                                        Dtype dtype);
+    static FusedEWInstruction MakeBinary(BinaryEWOpCode op_code,
+                                         int64_t lhs,
+                                         int64_t rhs,
+                                         Dtype dtype);
+
+    Type type_ = Type::Input;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    /// Index into the input tensors for Type::Input.
+    int64_t input_idx_ = 0;
+    /// Operand registers. Unary instructions only use lhs_.
+    int64_t lhs_ = 0;
+    int64_t rhs_ = 0;
+    /// Dtype of the register written by this instruction.
+    Dtype dtype_ = Dtype::Float32;
+};
+
+/// Evaluates \p program element-wise in a single pass over the output. The
+/// inputs are broadcasted to the shape of \p dst, and the register of the last
+/// instruction is written to \p dst. On CPU, intermediate registers only hold
+/// a small tile of elements at a time and never touch main memory. Devices
+/// without a fused implementation evaluate the program one op at a time.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+/// Evaluates \p program with one UnaryEW / BinaryEW kernel per instruction.
+void FusedEWUnfused(const std::vector<Tensor>& inputs,
+                    const std::vector<FusedEWInstruction>& program,
+                    Tensor& dst);
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,339 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Number of elements evaluated per tile. Each register holds one tile, so
+/// all registers of a program typically stay in L1/L2 cache.
+static constexpr int64_t FUSED_EW_TILE_SIZE = 256;
+
+template <typename src_t, typename dst_t, typename func_t>
+static void CPUFusedUnaryTile(const char* src,
+                              char* dst,
+                              int64_t num_elements,
+                              func_t element_func) {
+    const src_t* src_ptr = reinterpret_cast<const src_t*>(src);
+    dst_t* dst_ptr = reinterpret_cast<dst_t*>(dst);
+    for (int64_t i = 0; i < num_elements; ++i) {
+        dst_ptr[i] = element_func(src_ptr[i]);
+    }
+}
+
+template <typename src_t, typename dst_t, typename func_t>
+static void CPUFusedBinaryTile(const char* lhs,
+                               const char* rhs,
+                               char* dst,
+                               int64_t num_elements,
+                               func_t element_func) {
+    const src_t* lhs_ptr = reinterpret_cast<const src_t*>(lhs);
+    const src_t* rhs_ptr = reinterpret_cast<const src_t*>(rhs);
+    dst_t* dst_ptr = reinterpret_cast<dst_t*>(dst);
+    for (int64_t i = 0; i < num_elements; ++i) {
+        dst_ptr[i] = element_func(lhs_ptr[i], rhs_ptr[i]);
+    }
+}
+
+static void CPUFusedUnary(UnaryEWOpCode op_code,
+                          Dtype src_dtype,
+                          const char* src,
+                          char* dst,
+                          int64_t num_elements) {
+    if (op_code == UnaryEWOpCode::LogicalNot) {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            CPUFusedUnaryTile<scalar_t, bool>(
+                    src, dst, num_elements,
+                    [](scalar_t x) { return !static_cast<bool>(x); });
+        });
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        switch (op_code) {
+            case UnaryEWOpCode::Sqrt:
+                CPUFusedUnaryTile<scalar_t, scalar_t>(
+                        src, dst, num_elements, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::sqrt(x));
+                        });
+                break;
+            case UnaryEWOpCode::Sin:
+                CPUFusedUnaryTile<scalar_t, scalar_t>(
+                        src, dst, num_elements, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::sin(x));
+                        });
+                break;
+            case UnaryEWOpCode::Cos:
+                CPUFusedUnaryTile<scalar_t, scalar_t>(
+                        src, dst, num_elements, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::cos(x));
+                        });
+                break;
+            case UnaryEWOpCode::Neg:
+                CPUFusedUnaryTile<scalar_t, scalar_t>(
+                        src, dst, num_elements,
+                        [](scalar_t x) { return static_cast<scalar_t>(-x); });
+                break;
+            case UnaryEWOpCode::Exp:
+                CPUFusedUnaryTile<scalar_t, scalar_t>(
+                        src, dst, num_elements, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::exp(x));
+                        });
+                break;
+            case UnaryEWOpCode::Abs:
+                CPUFusedUnaryTile<scalar_t, scalar_t>(
+                        src, dst, num_elements, [](scalar_t x) {
+                            return static_cast<scalar_t>(
+                                    std::abs(static_cast<double>(x)));
+                        });
+                break;
+            default:
+                break;
+        }
+    });
+}
+
+static void CPUFusedBinary(BinaryEWOpCode op_code,
+                           Dtype src_dtype,
+                           const char* lhs,
+                           const char* rhs,
+                           char* dst,
+                           int64_t num_elements) {
+    if (s_boolean_binary_ew_op_codes.count(op_code)) {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            switch (op_code) {
+                case BinaryEWOpCode::LogicalAnd:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) {
+                                return static_cast<bool>(a) &&
+                                       static_cast<bool>(b);
+                            });
+                    break;
+                case BinaryEWOpCode::LogicalOr:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) {
+                                return static_cast<bool>(a) ||
+                                       static_cast<bool>(b);
+                            });
+                    break;
+                case BinaryEWOpCode::LogicalXor:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) {
+                                return static_cast<bool>(a) !=
+                                       static_cast<bool>(b);
+                            });
+                    break;
+                case BinaryEWOpCode::Gt:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) { return a > b; });
+                    break;
+                case BinaryEWOpCode::Lt:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) { return a < b; });
+                    break;
+                case BinaryEWOpCode::Ge:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) { return a >= b; });
+                    break;
+                case BinaryEWOpCode::Le:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) { return a <= b; });
+                    break;
+                case BinaryEWOpCode::Eq:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) { return a == b; });
+                    break;
+                case BinaryEWOpCode::Ne:
+                    CPUFusedBinaryTile<scalar_t, bool>(
+                            lhs, rhs, dst, num_elements,
+                            [](scalar_t a, scalar_t b) { return a != b; });
+                    break;
+                default:
+                    break;
+            }
+        });
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        switch (op_code) {
+            case BinaryEWOpCode::Add:
+                CPUFusedBinaryTile<scalar_t, scalar_t>(
+                        lhs, rhs, dst, num_elements,
+                        [](scalar_t a, scalar_t b) { return a + b; });
+                break;
+            case BinaryEWOpCode::Sub:
+                CPUFusedBinaryTile<scalar_t, scalar_t>(
+                        lhs, rhs, dst, num_elements,
+                        [](scalar_t a, scalar_t b) { return a - b; });
+                break;
+            case BinaryEWOpCode::Mul:
+                CPUFusedBinaryTile<scalar_t, scalar_t>(
+                        lhs, rhs, dst, num_elements,
+                        [](scalar_t a, scalar_t b) { return a * b; });
+                break;
+            case BinaryEWOpCode::Div:
+                CPUFusedBinaryTile<scalar_t, scalar_t>(
+                        lhs, rhs, dst, num_elements,
+                        [](scalar_t a, scalar_t b) { return a / b; });
+                break;
+            default:
+                break;
+        }
+    });
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    // The program has been checked by FusedEW.
+    Indexer indexer(inputs, dst, DtypePolicy::NONE);
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_tiles =
+            (num_workloads + FUSED_EW_TILE_SIZE - 1) / FUSED_EW_TILE_SIZE;
+    const int64_t num_registers = static_cast<int64_t>(program.size());
+    const int64_t output_byte_size = DtypeUtil::ByteSize(dst.GetDtype());
+    const bool output_contiguous = indexer.IsOutputContiguous();
+    std::vector<bool> input_scalar(inputs.size());
+    std::vector<bool> input_contiguous(inputs.size());
+    for (int64_t i = 0; i < static_cast<int64_t>(inputs.size()); ++i) {
+        input_scalar[i] = indexer.IsInputScalar(i);
+        input_contiguous[i] = indexer.IsInputContiguous(i);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Contiguous inputs are read in place, broadcasted scalar inputs are
+        // filled into their register once, other inputs are gathered per
+        // tile. The last register is computed in place if the output is
+        // contiguous.
+        std::vector<double> storage(num_registers * FUSED_EW_TILE_SIZE);
+        std::vector<const char*> registers(num_registers, nullptr);
+        auto get_storage = [&](int64_t register_idx) {
+            return reinterpret_cast<char*>(storage.data() +
+                                           register_idx * FUSED_EW_TILE_SIZE);
+        };
+        for (int64_t i = 0; i < num_registers; ++i) {
+            const FusedEWInstruction& instruction = program[i];
+            int64_t input_idx = instruction.input_idx_;
+            if (instruction.type_ == FusedEWInstruction::Type::Input &&
+                num_workloads > 0 && input_scalar[input_idx]) {
+                int64_t byte_size = DtypeUtil::ByteSize(instruction.dtype_);
+                const char* src = indexer.GetInputPtr(input_idx, 0);
+                char* reg = get_storage(i);
+                for (int64_t j = 0; j < FUSED_EW_TILE_SIZE; ++j) {
+                    std::memcpy(reg + j * byte_size, src, byte_size);
+                }
+                registers[i] = reg;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+            const int64_t start = tile_idx * FUSED_EW_TILE_SIZE;
+            const int64_t num_elements =
+                    std::min(FUSED_EW_TILE_SIZE, num_workloads - start);
+            char* last_reg = output_contiguous ? indexer.GetOutputPtr(start)
+                                               : get_storage(num_registers - 1);
+
+            for (int64_t i = 0; i < num_registers; ++i) {
+                const FusedEWInstruction& instruction = program[i];
+                char* reg = i == num_registers - 1 ? last_reg : get_storage(i);
+                if (instruction.type_ == FusedEWInstruction::Type::Input) {
+                    int64_t input_idx = instruction.input_idx_;
+                    if (input_scalar[input_idx]) {
+                        continue;
+                    } else if (input_contiguous[input_idx]) {
+                        registers[i] = indexer.GetInputPtr(input_idx, start);
+                    } else {
+                        int64_t byte_size =
+                                DtypeUtil::ByteSize(instruction.dtype_);
+                        char* gathered = get_storage(i);
+                        for (int64_t j = 0; j < num_elements; ++j) {
+                            std::memcpy(gathered + j * byte_size,
+                                        indexer.GetInputPtr(input_idx,
+                                                            start + j),
+                                        byte_size);
+                        }
+                        registers[i] = gathered;
+                    }
+                } else if (instruction.type_ ==
+                           FusedEWInstruction::Type::Unary) {
+                    CPUFusedUnary(instruction.unary_op_code_,
+                                  program[instruction.lhs_].dtype_,
+                                  registers[instruction.lhs_], reg,
+                                  num_elements);
+                    registers[i] = reg;
+                } else {
+                    CPUFusedBinary(instruction.binary_op_code_,
+                                   program[instruction.lhs_].dtype_,
+                                   registers[instruction.lhs_],
+                                   registers[instruction.rhs_], reg,
+                                   num_elements);
+                    registers[i] = reg;
+                }
+            }
+
+            const char* result = registers[num_registers - 1];
+            if (output_contiguous) {
+                if (result != last_reg) {
+                    std::memcpy(last_reg, result,
+                                num_elements * output_byte_size);
+                }
+            } else {
+                for (int64_t j = 0; j < num_elements; ++j) {
+                    std::memcpy(indexer.GetOutputPtr(start + j),
+                                result + j * output_byte_size,
+                                output_byte_size);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
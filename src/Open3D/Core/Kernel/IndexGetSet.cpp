@@ -28,6 +28,7 @@
 
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/KernelProfiler.h"
 #include "Open3D/Core/MemoryManager.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
@@ -51,6 +52,7 @@ void IndexGet(const Tensor& src,
         return;
     }
 
+    KernelProfileScope profile_scope("IndexGet", src, dst);
     if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexGetCPU(src, dst, index_tensors, indexed_shape, indexed_strides);
     } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -76,6 +78,7 @@ void IndexSet(const Tensor& src,
         return;
     }
 
+    KernelProfileScope profile_scope("IndexSet", src, dst);
     if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexSetCPU(src, dst, index_tensors, indexed_shape, indexed_strides);
     } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -87,5 +90,51 @@ void IndexSet(const Tensor& src,
     }
 }
 
+static void CheckRowIndex(const Tensor& index, const Tensor& src) {
+    if (index.GetDtype() != Dtype::Int64 || index.NumDims() != 1) {
+        utility::LogError("Index must be a 1-D Int64 tensor, but got {} {}.",
+                          DtypeUtil::ToString(index.GetDtype()),
+                          index.GetShape().ToString());
+    }
+    if (index.GetDevice() != src.GetDevice()) {
+        utility::LogError("Index device {} does not match tensor device {}.",
+                          index.GetDevice().ToString(),
+                          src.GetDevice().ToString());
+    }
+}
+
+void IndexGetRows(const Tensor& src, const Tensor& index, Tensor& dst) {
+    CheckRowIndex(index, src);
+    KernelProfileScope profile_scope("IndexGetRows", src, index, dst);
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(src, index, dst);
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const Tensor& src, const Tensor& index, Tensor& dst) {
+    CheckRowIndex(index, dst);
+    KernelProfileScope profile_scope("IndexSetRows", src, index, dst);
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(src, index, dst);
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
+void IndexAdd(const Tensor& src,
+              const Tensor& index,
+              int64_t dim,
+              Tensor& dst) {
+    CheckRowIndex(index, dst);
+    KernelProfileScope profile_scope("IndexAdd", src, index, dst);
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexAddCPU(src, index, dim, dst);
+    } else {
+        utility::LogError("IndexAdd: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace open3d
@@ -72,5 +72,28 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Row gather dst[i] = src[index[i]] for a contiguous \p src and \p dst.
+/// \p index is a 1-D Int64 tensor indexing dim 0 of \p src. Negative indices
+/// count from the end.
+void IndexGetRows(const Tensor& src, const Tensor& index, Tensor& dst);
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst);
+
+/// Row scatter dst[index[i]] = src[i] for a contiguous \p src and \p dst.
+/// With duplicated indices, which row is written last is unspecified.
+void IndexSetRows(const Tensor& src, const Tensor& index, Tensor& dst);
+
+void IndexSetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst);
+
+/// Scatter-add of the slices of \p src along \p dim into \p dst, i.e.
+/// dst[..., index[i], ...] += src[..., i, ...]. Duplicated indices accumulate.
+/// \p src and \p dst are contiguous.
+void IndexAdd(const Tensor& src, const Tensor& index, int64_t dim, Tensor& dst);
+
+void IndexAddCPU(const Tensor& src,
+                 const Tensor& index,
+                 int64_t dim,
+                 Tensor& dst);
+
 }  // namespace kernel
 }  // namespace open3d
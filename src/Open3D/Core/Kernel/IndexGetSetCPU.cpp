@@ -26,9 +26,14 @@
 
 #include "Open3D/Core/Kernel/IndexGetSet.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
 
@@ -68,5 +73,237 @@ void IndexSetCPU(const Tensor& src,
     });
 }
 
+/// Row indexing kernels run in parallel when they move at least this many
+/// bytes.
+static constexpr int64_t ROW_INDEXING_GRAIN_SIZE = 1 << 16;
+
+/// Checks that all indices are within [-num_rows, num_rows).
+static void CheckIndexBounds(const int64_t* index_ptr,
+                             int64_t num_indices,
+                             int64_t num_rows) {
+    int64_t num_invalid = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : num_invalid) \
+        if (num_indices >= ROW_INDEXING_GRAIN_SIZE)
+#endif
+    for (int64_t i = 0; i < num_indices; ++i) {
+        num_invalid += index_ptr[i] < -num_rows || index_ptr[i] >= num_rows;
+    }
+    if (num_invalid > 0) {
+        utility::LogError("{} indices are out of bounds for size {}.",
+                          num_invalid, num_rows);
+    }
+}
+
+/// Copies rows of \p row_bytes bytes from src_ptr[src_row(i)] to
+/// dst_ptr[dst_row(i)] for i in [0, num_rows). Rows of common small sizes are
+/// copied with a fixed-size memcpy that compiles to plain loads and stores.
+template <int64_t ROW_BYTES, typename src_row_t, typename dst_row_t>
+static void CopyRowsFixed(const char* src_ptr,
+                          char* dst_ptr,
+                          int64_t num_rows,
+                          int64_t row_bytes,
+                          src_row_t src_row,
+                          dst_row_t dst_row) {
+    bool parallel = num_rows * row_bytes >= ROW_INDEXING_GRAIN_SIZE;
+    (void)parallel;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (parallel)
+#endif
+    for (int64_t i = 0; i < num_rows; ++i) {
+        std::memcpy(dst_ptr + dst_row(i) * row_bytes,
+                    src_ptr + src_row(i) * row_bytes,
+                    ROW_BYTES > 0 ? ROW_BYTES : row_bytes);
+    }
+}
+
+template <typename src_row_t, typename dst_row_t>
+static void CopyRows(const char* src_ptr,
+                     char* dst_ptr,
+                     int64_t num_rows,
+                     int64_t row_bytes,
+                     src_row_t src_row,
+                     dst_row_t dst_row) {
+    switch (row_bytes) {
+        case 4:
+            CopyRowsFixed<4>(src_ptr, dst_ptr, num_rows, row_bytes, src_row,
+                             dst_row);
+            break;
+        case 8:
+            CopyRowsFixed<8>(src_ptr, dst_ptr, num_rows, row_bytes, src_row,
+                             dst_row);
+            break;
+        case 12:
+            CopyRowsFixed<12>(src_ptr, dst_ptr, num_rows, row_bytes, src_row,
+                              dst_row);
+            break;
+        case 16:
+            CopyRowsFixed<16>(src_ptr, dst_ptr, num_rows, row_bytes, src_row,
+                              dst_row);
+            break;
+        case 24:
+            CopyRowsFixed<24>(src_ptr, dst_ptr, num_rows, row_bytes, src_row,
+                              dst_row);
+            break;
+        default:
+            CopyRowsFixed<0>(src_ptr, dst_ptr, num_rows, row_bytes, src_row,
+                             dst_row);
+            break;
+    }
+}
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst) {
+    int64_t num_rows = src.GetShape()[0];
+    int64_t num_indices = index.NumElements();
+    int64_t row_bytes = num_rows == 0 ? 0
+                                      : src.NumElements() / num_rows *
+                                                DtypeUtil::ByteSize(
+                                                        src.GetDtype());
+    Tensor index_contiguous = index.Contiguous();
+    const int64_t* index_ptr =
+            static_cast<const int64_t*>(index_contiguous.GetDataPtr());
+    CheckIndexBounds(index_ptr, num_indices, num_rows);
+    if (row_bytes == 0) {
+        return;
+    }
+
+    CopyRows(
+            static_cast<const char*>(src.GetDataPtr()),
+            static_cast<char*>(dst.GetDataPtr()), num_indices, row_bytes,
+            [&](int64_t i) {
+                int64_t row = index_ptr[i];
+                return row + num_rows * (row < 0);
+            },
+            [](int64_t i) { return i; });
+}
+
+void IndexSetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst) {
+    int64_t num_rows = dst.GetShape()[0];
+    int64_t num_indices = index.NumElements();
+    int64_t row_bytes = num_rows == 0 ? 0
+                                      : dst.NumElements() / num_rows *
+                                                DtypeUtil::ByteSize(
+                                                        dst.GetDtype());
+    Tensor index_contiguous = index.Contiguous();
+    const int64_t* index_ptr =
+            static_cast<const int64_t*>(index_contiguous.GetDataPtr());
+    CheckIndexBounds(index_ptr, num_indices, num_rows);
+    if (row_bytes == 0) {
+        return;
+    }
+
+    CopyRows(
+            static_cast<const char*>(src.GetDataPtr()),
+            static_cast<char*>(dst.GetDataPtr()), num_indices, row_bytes,
+            [](int64_t i) { return i; },
+            [&](int64_t i) {
+                int64_t row = index_ptr[i];
+                return row + num_rows * (row < 0);
+            });
+}
+
+/// Accumulates src {outer, num_indices, inner} into dst {outer, num_rows,
+/// inner}. Owner o handles the indices order[owner_begin[o]:owner_begin[o+1]],
+/// all of which point into its own range of destination rows.
+template <typename scalar_t>
+static void AccumulateRows(const scalar_t* src_ptr,
+                           scalar_t* dst_ptr,
+                           const int64_t* index_ptr,
+                           const int64_t* order,
+                           const std::vector<int64_t>& owner_begin,
+                           int64_t num_rows,
+                           int64_t outer,
+                           int64_t inner) {
+    int64_t num_owners = static_cast<int64_t>(owner_begin.size()) - 1;
+    int64_t num_indices = owner_begin.back();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (num_owners > 1)
+#endif
+    for (int64_t o = 0; o < num_owners; ++o) {
+        for (int64_t k = owner_begin[o]; k < owner_begin[o + 1]; ++k) {
+            int64_t i = order[k];
+            int64_t row = index_ptr[i] + num_rows * (index_ptr[i] < 0);
+            for (int64_t b = 0; b < outer; ++b) {
+                const scalar_t* src_row =
+                        src_ptr + (b * num_indices + i) * inner;
+                scalar_t* dst_row = dst_ptr + (b * num_rows + row) * inner;
+                for (int64_t j = 0; j < inner; ++j) {
+                    dst_row[j] += src_row[j];
+                }
+            }
+        }
+    }
+}
+
+void IndexAddCPU(const Tensor& src,
+                 const Tensor& index,
+                 int64_t dim,
+                 Tensor& dst) {
+    // View src as {outer, num_indices, inner} and dst as {outer, num_rows,
+    // inner}.
+    const SizeVector& dst_shape = dst.GetShape();
+    int64_t num_rows = dst_shape[dim];
+    int64_t num_indices = index.NumElements();
+    int64_t outer = 1;
+    for (int64_t d = 0; d < dim; ++d) {
+        outer *= dst_shape[d];
+    }
+    int64_t inner = 1;
+    for (int64_t d = dim + 1; d < dst.NumDims(); ++d) {
+        inner *= dst_shape[d];
+    }
+    Tensor index_contiguous = index.Contiguous();
+    const int64_t* index_ptr =
+            static_cast<const int64_t*>(index_contiguous.GetDataPtr());
+    CheckIndexBounds(index_ptr, num_indices, num_rows);
+    if (num_indices == 0 || outer * inner == 0) {
+        return;
+    }
+
+    // Each owner accumulates into a disjoint range of destination rows, so no
+    // two threads write the same element. The indices are first bucketed by
+    // owner with a stable counting sort; every owner then visits its indices
+    // in their original order, making the result deterministic.
+    int64_t num_owners = std::min<int64_t>(parallel_util::GetMaxThreads(),
+                                           num_rows);
+    if (num_indices * inner * outer <
+        ROW_INDEXING_GRAIN_SIZE / DtypeUtil::ByteSize(dst.GetDtype())) {
+        num_owners = 1;
+    }
+    auto normalize = [&](int64_t i) {
+        int64_t row = index_ptr[i];
+        return row + num_rows * (row < 0);
+    };
+    auto owner_of = [&](int64_t row) { return row * num_owners / num_rows; };
+
+    std::vector<int64_t> owner_begin(num_owners + 1, 0);
+    std::vector<int64_t> order(num_indices);
+    if (num_owners == 1) {
+        owner_begin[1] = num_indices;
+        for (int64_t i = 0; i < num_indices; ++i) {
+            order[i] = i;
+        }
+    } else {
+        std::vector<int32_t> owners(num_indices);
+        for (int64_t i = 0; i < num_indices; ++i) {
+            owners[i] = static_cast<int32_t>(owner_of(normalize(i)));
+            owner_begin[owners[i] + 1]++;
+        }
+        for (int64_t o = 0; o < num_owners; ++o) {
+            owner_begin[o + 1] += owner_begin[o];
+        }
+        std::vector<int64_t> cursor(owner_begin.begin(), owner_begin.end() - 1);
+        for (int64_t i = 0; i < num_indices; ++i) {
+            order[cursor[owners[i]]++] = i;
+        }
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        AccumulateRows(static_cast<const scalar_t*>(src.GetDataPtr()),
+                       static_cast<scalar_t*>(dst.GetDataPtr()), index_ptr,
+                       order.data(), owner_begin, num_rows, outer, inner);
+    });
+}
+
 }  // namespace kernel
 }  // namespace open3d
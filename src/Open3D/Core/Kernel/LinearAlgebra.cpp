@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+static void CheckSameDevice(const Tensor& a, const Tensor& b) {
+    if (a.GetDevice() != b.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          a.GetDevice().ToString(), b.GetDevice().ToString());
+    }
+}
+
+static void CheckSameDtype(const Tensor& a, const Tensor& b) {
+    if (a.GetDtype() != b.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(a.GetDtype()),
+                          DtypeUtil::ToString(b.GetDtype()));
+    }
+}
+
+static void CheckFloatDtype(const Tensor& t) {
+    if (t.GetDtype() != Dtype::Float32 && t.GetDtype() != Dtype::Float64) {
+        utility::LogError("Only Float32 and Float64 are supported, but got {}.",
+                          DtypeUtil::ToString(t.GetDtype()));
+    }
+}
+
+static void CheckSquareMatrices(const Tensor& t) {
+    int64_t ndims = t.NumDims();
+    if (ndims < 2 || t.GetShape()[ndims - 1] != t.GetShape()[ndims - 2]) {
+        utility::LogError("Expected square matrices (..., N, N), but got {}.",
+                          t.GetShape());
+    }
+}
+
+static void CheckOutput(const Tensor& dst, const SizeVector& expected_shape) {
+    if (dst.GetShape() != expected_shape) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          expected_shape.ToString(), dst.GetShape().ToString());
+    }
+    if (!dst.IsContiguous()) {
+        utility::LogError("Output tensor must be contiguous.");
+    }
+}
+
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    CheckSameDevice(lhs, rhs);
+    CheckSameDevice(lhs, dst);
+    CheckSameDtype(lhs, rhs);
+    CheckSameDtype(lhs, dst);
+    if (lhs.GetDtype() == Dtype::Bool) {
+        utility::LogError("Matmul does not support Bool tensors.");
+    }
+    CheckOutput(dst, shape_util::MatmulShape(lhs.GetShape(), rhs.GetShape()));
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MatmulCPU(lhs.Contiguous(), rhs.Contiguous(), dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        utility::LogError("Matmul is not implemented for CUDA.");
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void Inverse(const Tensor& src, Tensor& dst) {
+    CheckSameDevice(src, dst);
+    CheckSameDtype(src, dst);
+    CheckFloatDtype(src);
+    CheckSquareMatrices(src);
+    CheckOutput(dst, src.GetShape());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        InverseCPU(src.Contiguous(), dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        utility::LogError("Inverse is not implemented for CUDA.");
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void Solve(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    CheckSameDevice(lhs, rhs);
+    CheckSameDevice(lhs, dst);
+    CheckSameDtype(lhs, rhs);
+    CheckSameDtype(lhs, dst);
+    CheckFloatDtype(lhs);
+    CheckSquareMatrices(lhs);
+
+    // B is either a batch of matrices (..., N, K) or of vectors (..., N).
+    const SizeVector& a_shape = lhs.GetShape();
+    const SizeVector& b_shape = rhs.GetShape();
+    SizeVector a_batch(a_shape.begin(), a_shape.end() - 2);
+    int64_t n = a_shape[a_shape.size() - 1];
+    bool b_is_matrix = b_shape.size() == a_shape.size();
+    bool b_is_vector = b_shape.size() + 1 == a_shape.size();
+    if (!b_is_matrix && !b_is_vector) {
+        utility::LogError("Solve shape mismatch: A {} and B {}.", a_shape,
+                          b_shape);
+    }
+    SizeVector b_batch(b_shape.begin(), b_shape.begin() + a_batch.size());
+    if (b_batch != a_batch || b_shape[a_batch.size()] != n) {
+        utility::LogError("Solve shape mismatch: A {} and B {}.", a_shape,
+                          b_shape);
+    }
+    CheckOutput(dst, b_shape);
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SolveCPU(lhs.Contiguous(), rhs.Contiguous(), dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        utility::LogError("Solve is not implemented for CUDA.");
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void SVD3x3(const Tensor& src, Tensor& u, Tensor& s, Tensor& v) {
+    CheckSameDevice(src, u);
+    CheckSameDevice(src, s);
+    CheckSameDevice(src, v);
+    CheckSameDtype(src, u);
+    CheckSameDtype(src, s);
+    CheckSameDtype(src, v);
+    CheckFloatDtype(src);
+    const SizeVector& shape = src.GetShape();
+    int64_t ndims = src.NumDims();
+    if (ndims < 2 || shape[ndims - 2] != 3 || shape[ndims - 1] != 3) {
+        utility::LogError("SVD expects 3x3 matrices (..., 3, 3), but got {}.",
+                          shape);
+    }
+    SizeVector s_shape(shape.begin(), shape.end() - 1);
+    CheckOutput(u, shape);
+    CheckOutput(s, s_shape);
+    CheckOutput(v, shape);
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SVD3x3CPU(src.Contiguous(), u, s, v);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        utility::LogError("SVD is not implemented for CUDA.");
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
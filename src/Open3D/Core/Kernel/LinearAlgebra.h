@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Batched matrix multiplication, dst = lhs @ rhs. The last two dims of
+/// \p lhs (..., M, K) and \p rhs (..., K, N) are the matrix dims and the
+/// leading batch dims are broadcasted. \p dst must have shape
+/// shape_util::MatmulShape(lhs, rhs).
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+/// Batched inverse of square matrices (..., N, N). Only Float32 and Float64
+/// are supported. Throws if any of the matrices is singular.
+void Inverse(const Tensor& src, Tensor& dst);
+
+/// Batched linear solve A X = B with A (..., N, N) and B (..., N, K) or B
+/// (..., N). The batch dims of A and B must match. Only Float32 and Float64
+/// are supported. Throws if any of the matrices is singular.
+void Solve(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+/// Batched singular value decomposition of 3x3 matrices, A = U diag(S) V^T.
+/// \p src has shape (..., 3, 3), \p u and \p v have the same shape as \p src
+/// and \p s has shape (..., 3) sorted in decreasing order.
+void SVD3x3(const Tensor& src, Tensor& u, Tensor& s, Tensor& v);
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+void InverseCPU(const Tensor& src, Tensor& dst);
+
+void SolveCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+void SVD3x3CPU(const Tensor& src, Tensor& u, Tensor& s, Tensor& v);
+
+}  // namespace kernel
+}  // namespace open3d
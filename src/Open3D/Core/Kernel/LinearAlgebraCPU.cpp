@@ -0,0 +1,447 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#ifdef WITH_BLAS
+#include <cblas.h>
+#endif
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Rows, depth and columns of the C, A and B tiles of the blocked GEMM. A
+/// KC x NC panel of B (128 KiB for float) stays in L2 while MC rows of A
+/// stream through it.
+static constexpr int64_t GEMM_BLOCK_M = 32;
+static constexpr int64_t GEMM_BLOCK_K = 128;
+static constexpr int64_t GEMM_BLOCK_N = 256;
+
+/// Matrices with K and N up to this size are multiplied without tiling.
+static constexpr int64_t GEMM_SMALL_SIZE = 8;
+
+/// Below this many multiply-adds a kernel runs on a single thread.
+static constexpr int64_t LINALG_PARALLEL_GRAIN_SIZE = 32768;
+
+/// Returns the element offset of the matrix of each batch in a contiguous
+/// tensor of shape \p src_shape (..., R, C), whose batch dims are broadcasted
+/// to \p batch_shape.
+static std::vector<int64_t> BatchOffsets(const SizeVector& batch_shape,
+                                         const SizeVector& src_shape) {
+    int64_t ndims = batch_shape.size();
+    int64_t src_ndims = src_shape.size() - 2;
+    int64_t matrix_size = src_shape[src_ndims] * src_shape[src_ndims + 1];
+    int64_t num_batches = batch_shape.NumElements();
+    int64_t src_num_batches =
+            SizeVector(src_shape.begin(), src_shape.end() - 2).NumElements();
+    std::vector<int64_t> offsets(num_batches);
+
+    // No broadcasting, or a single matrix shared by all batches.
+    if (src_num_batches == num_batches || src_num_batches == 1) {
+        int64_t batch_stride = src_num_batches == 1 ? 0 : matrix_size;
+        for (int64_t b = 0; b < num_batches; ++b) {
+            offsets[b] = b * batch_stride;
+        }
+        return offsets;
+    }
+
+    // Broadcasted dims get a stride of 0.
+    std::vector<int64_t> strides(ndims, 0);
+    int64_t stride = matrix_size;
+    for (int64_t i = src_ndims - 1; i >= 0; --i) {
+        strides[i + ndims - src_ndims] = src_shape[i] == 1 ? 0 : stride;
+        stride *= src_shape[i];
+    }
+    for (int64_t b = 0; b < num_batches; ++b) {
+        int64_t remain = b;
+        int64_t offset = 0;
+        for (int64_t d = ndims - 1; d >= 0; --d) {
+            offset += (remain % batch_shape[d]) * strides[d];
+            remain /= batch_shape[d];
+        }
+        offsets[b] = offset;
+    }
+    return offsets;
+}
+
+/// Computes rows [row_begin, row_end) of the row-major product C = A B, where
+/// A is M x K, B is K x N and C is M x N. The innermost loop runs along a row
+/// of B and C so that it vectorizes.
+template <typename scalar_t>
+static void GemmRowBlock(const scalar_t* a,
+                         const scalar_t* b,
+                         scalar_t* c,
+                         int64_t k_size,
+                         int64_t n_size,
+                         int64_t row_begin,
+                         int64_t row_end) {
+    std::fill(c + row_begin * n_size, c + row_end * n_size, scalar_t(0));
+    for (int64_t k0 = 0; k0 < k_size; k0 += GEMM_BLOCK_K) {
+        int64_t k1 = std::min(k0 + GEMM_BLOCK_K, k_size);
+        for (int64_t j0 = 0; j0 < n_size; j0 += GEMM_BLOCK_N) {
+            int64_t j1 = std::min(j0 + GEMM_BLOCK_N, n_size);
+            for (int64_t i = row_begin; i < row_end; ++i) {
+                const scalar_t* a_row = a + i * k_size;
+                scalar_t* c_row = c + i * n_size;
+                for (int64_t k = k0; k < k1; ++k) {
+                    const scalar_t a_ik = a_row[k];
+                    const scalar_t* b_row = b + k * n_size;
+                    for (int64_t j = j0; j < j1; ++j) {
+                        c_row[j] += a_ik * b_row[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Computes C = A B for each batch of tiny matrices. A non-zero \p K or \p N
+/// fixes the corresponding size at compile time so that the loops unroll.
+template <typename scalar_t, int64_t K, int64_t N>
+static void BatchedSmallGemm(const scalar_t* lhs_ptr,
+                             const std::vector<int64_t>& lhs_offsets,
+                             const scalar_t* rhs_ptr,
+                             const std::vector<int64_t>& rhs_offsets,
+                             scalar_t* dst_ptr,
+                             int64_t m_size,
+                             int64_t k_size,
+                             int64_t n_size) {
+    const int64_t k_dim = K > 0 ? K : k_size;
+    const int64_t n_dim = N > 0 ? N : n_size;
+    int64_t num_batches = lhs_offsets.size();
+    bool parallel = num_batches * m_size * n_dim * k_dim >=
+                    LINALG_PARALLEL_GRAIN_SIZE;
+    (void)parallel;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (parallel)
+#endif
+    for (int64_t b = 0; b < num_batches; ++b) {
+        const scalar_t* a = lhs_ptr + lhs_offsets[b];
+        const scalar_t* r = rhs_ptr + rhs_offsets[b];
+        scalar_t* c = dst_ptr + b * m_size * n_dim;
+        for (int64_t i = 0; i < m_size; ++i) {
+            for (int64_t j = 0; j < n_dim; ++j) {
+                scalar_t sum = 0;
+                for (int64_t k = 0; k < k_dim; ++k) {
+                    sum += a[i * k_dim + k] * r[k * n_dim + j];
+                }
+                c[i * n_dim + j] = sum;
+            }
+        }
+    }
+}
+
+/// Computes C = A B with an external BLAS. Returns false if BLAS is not
+/// available for \p scalar_t.
+template <typename scalar_t>
+static bool BlasGemm(const scalar_t* /*a*/,
+                     const scalar_t* /*b*/,
+                     scalar_t* /*c*/,
+                     int64_t /*m_size*/,
+                     int64_t /*k_size*/,
+                     int64_t /*n_size*/) {
+    return false;
+}
+
+#ifdef WITH_BLAS
+template <>
+bool BlasGemm<float>(const float* a,
+                     const float* b,
+                     float* c,
+                     int64_t m_size,
+                     int64_t k_size,
+                     int64_t n_size) {
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m_size, n_size,
+                k_size, 1.0f, a, k_size, b, n_size, 0.0f, c, n_size);
+    return true;
+}
+
+template <>
+bool BlasGemm<double>(const double* a,
+                      const double* b,
+                      double* c,
+                      int64_t m_size,
+                      int64_t k_size,
+                      int64_t n_size) {
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m_size, n_size,
+                k_size, 1.0, a, k_size, b, n_size, 0.0, c, n_size);
+    return true;
+}
+#endif
+
+template <typename scalar_t>
+static void MatmulCPUKernel(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    const SizeVector& dst_shape = dst.GetShape();
+    int64_t ndims = dst_shape.size();
+    int64_t m_size = dst_shape[ndims - 2];
+    int64_t n_size = dst_shape[ndims - 1];
+    int64_t k_size = lhs.GetShape()[lhs.NumDims() - 1];
+    int64_t matrix_size = m_size * n_size;
+    if (dst.NumElements() == 0) {
+        return;
+    }
+
+    SizeVector batch_shape(dst_shape.begin(), dst_shape.end() - 2);
+    std::vector<int64_t> lhs_offsets =
+            BatchOffsets(batch_shape, lhs.GetShape());
+    std::vector<int64_t> rhs_offsets =
+            BatchOffsets(batch_shape, rhs.GetShape());
+    int64_t num_batches = batch_shape.NumElements();
+    const scalar_t* lhs_ptr = static_cast<const scalar_t*>(lhs.GetDataPtr());
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    // Large matrices go to BLAS one at a time since BLAS is multi-threaded
+    // itself. Batches of small matrices are better served by the loop below.
+    if (matrix_size * k_size >= LINALG_PARALLEL_GRAIN_SIZE * 8) {
+        bool used_blas = true;
+        for (int64_t b = 0; b < num_batches && used_blas; ++b) {
+            used_blas = BlasGemm(lhs_ptr + lhs_offsets[b],
+                                 rhs_ptr + rhs_offsets[b],
+                                 dst_ptr + b * matrix_size, m_size, k_size,
+                                 n_size);
+        }
+        if (used_blas) {
+            return;
+        }
+    }
+
+    // Batches of tiny matrices, e.g. 3x3 rotations, skip the tiling.
+    if (k_size <= GEMM_SMALL_SIZE && n_size <= GEMM_SMALL_SIZE) {
+        auto gemm = BatchedSmallGemm<scalar_t, 0, 0>;
+        if (k_size == 3 && n_size == 3) {
+            gemm = BatchedSmallGemm<scalar_t, 3, 3>;
+        } else if (k_size == 4 && n_size == 4) {
+            gemm = BatchedSmallGemm<scalar_t, 4, 4>;
+        }
+        gemm(lhs_ptr, lhs_offsets, rhs_ptr, rhs_offsets, dst_ptr, m_size,
+             k_size, n_size);
+        return;
+    }
+
+    int64_t num_row_blocks = (m_size + GEMM_BLOCK_M - 1) / GEMM_BLOCK_M;
+    int64_t num_tasks = num_batches * num_row_blocks;
+    bool parallel = num_tasks > 1 && num_batches * matrix_size * k_size >=
+                                             LINALG_PARALLEL_GRAIN_SIZE;
+    (void)parallel;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (parallel)
+#endif
+    for (int64_t task = 0; task < num_tasks; ++task) {
+        int64_t b = task / num_row_blocks;
+        int64_t row_begin = (task % num_row_blocks) * GEMM_BLOCK_M;
+        int64_t row_end = std::min(row_begin + GEMM_BLOCK_M, m_size);
+        GemmRowBlock(lhs_ptr + lhs_offsets[b], rhs_ptr + rhs_offsets[b],
+                     dst_ptr + b * matrix_size, k_size, n_size, row_begin,
+                     row_end);
+    }
+}
+
+/// Solves A X = B in place by Gaussian elimination with partial pivoting. \p a
+/// is N x N and \p b is N x K, both row-major. \p a is overwritten by its
+/// upper triangular factor and \p b by X. Returns false if A is singular.
+template <typename scalar_t>
+static bool LUSolveInPlace(scalar_t* a, scalar_t* b, int64_t n, int64_t k) {
+    for (int64_t col = 0; col < n; ++col) {
+        int64_t pivot = col;
+        scalar_t pivot_abs = std::abs(a[col * n + col]);
+        for (int64_t row = col + 1; row < n; ++row) {
+            scalar_t v = std::abs(a[row * n + col]);
+            if (v > pivot_abs) {
+                pivot = row;
+                pivot_abs = v;
+            }
+        }
+        if (pivot_abs == 0) {
+            return false;
+        }
+        if (pivot != col) {
+            std::swap_ranges(a + col * n, a + (col + 1) * n, a + pivot * n);
+            std::swap_ranges(b + col * k, b + (col + 1) * k, b + pivot * k);
+        }
+        const scalar_t* a_pivot_row = a + col * n;
+        const scalar_t* b_pivot_row = b + col * k;
+        scalar_t inv_pivot = scalar_t(1) / a_pivot_row[col];
+        for (int64_t row = col + 1; row < n; ++row) {
+            scalar_t factor = a[row * n + col] * inv_pivot;
+            if (factor == 0) {
+                continue;
+            }
+            scalar_t* a_row = a + row * n;
+            scalar_t* b_row = b + row * k;
+            for (int64_t j = col + 1; j < n; ++j) {
+                a_row[j] -= factor * a_pivot_row[j];
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                b_row[j] -= factor * b_pivot_row[j];
+            }
+        }
+    }
+    for (int64_t row = n - 1; row >= 0; --row) {
+        const scalar_t* a_row = a + row * n;
+        scalar_t* b_row = b + row * k;
+        for (int64_t i = row + 1; i < n; ++i) {
+            const scalar_t* x_row = b + i * k;
+            for (int64_t j = 0; j < k; ++j) {
+                b_row[j] -= a_row[i] * x_row[j];
+            }
+        }
+        scalar_t inv_diag = scalar_t(1) / a_row[row];
+        for (int64_t j = 0; j < k; ++j) {
+            b_row[j] *= inv_diag;
+        }
+    }
+    return true;
+}
+
+/// Solves A X = B for each of the \p num_batches N x N matrices in \p a. \p x
+/// holds B on input and X on output.
+template <typename scalar_t>
+static void BatchedLUSolve(const scalar_t* a,
+                           scalar_t* x,
+                           int64_t num_batches,
+                           int64_t n,
+                           int64_t k) {
+    std::atomic<bool> singular(false);
+    bool parallel = num_batches > 1 &&
+                    num_batches * n * n * (n + k) >= LINALG_PARALLEL_GRAIN_SIZE;
+    (void)parallel;
+#ifdef _OPENMP
+#pragma omp parallel if (parallel)
+#endif
+    {
+        std::vector<scalar_t> a_copy(n * n);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t b = 0; b < num_batches; ++b) {
+            std::copy(a + b * n * n, a + (b + 1) * n * n, a_copy.begin());
+            if (!LUSolveInPlace(a_copy.data(), x + b * n * k, n, k)) {
+                singular = true;
+            }
+        }
+    }
+    if (singular) {
+        utility::LogError("Singular matrix encountered.");
+    }
+}
+
+template <typename scalar_t>
+static void InverseCPUKernel(const Tensor& src, Tensor& dst) {
+    int64_t n = src.GetShape()[src.NumDims() - 1];
+    int64_t num_batches = n == 0 ? 0 : src.NumElements() / (n * n);
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    for (int64_t b = 0; b < num_batches; ++b) {
+        scalar_t* eye = dst_ptr + b * n * n;
+        std::fill(eye, eye + n * n, scalar_t(0));
+        for (int64_t i = 0; i < n; ++i) {
+            eye[i * n + i] = 1;
+        }
+    }
+    BatchedLUSolve(static_cast<const scalar_t*>(src.GetDataPtr()), dst_ptr,
+                   num_batches, n, n);
+}
+
+template <typename scalar_t>
+static void SolveCPUKernel(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    int64_t n = lhs.GetShape()[lhs.NumDims() - 1];
+    int64_t num_batches = n == 0 ? 0 : lhs.NumElements() / (n * n);
+    int64_t k = rhs.NumDims() == lhs.NumDims()
+                        ? rhs.GetShape()[rhs.NumDims() - 1]
+                        : 1;
+    dst.AsRvalue() = rhs;
+    BatchedLUSolve(static_cast<const scalar_t*>(lhs.GetDataPtr()),
+                   static_cast<scalar_t*>(dst.GetDataPtr()), num_batches, n,
+                   k);
+}
+
+template <typename scalar_t>
+static void SVD3x3CPUKernel(const Tensor& src,
+                            Tensor& u,
+                            Tensor& s,
+                            Tensor& v) {
+    using Matrix3 = Eigen::Matrix<scalar_t, 3, 3, Eigen::RowMajor>;
+    using Vector3 = Eigen::Matrix<scalar_t, 3, 1>;
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* u_ptr = static_cast<scalar_t*>(u.GetDataPtr());
+    scalar_t* s_ptr = static_cast<scalar_t*>(s.GetDataPtr());
+    scalar_t* v_ptr = static_cast<scalar_t*>(v.GetDataPtr());
+    int64_t num_batches = src.NumElements() / 9;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (num_batches >= 256)
+#endif
+    for (int64_t b = 0; b < num_batches; ++b) {
+        Eigen::JacobiSVD<Matrix3> svd(
+                Eigen::Map<const Matrix3>(src_ptr + b * 9),
+                Eigen::ComputeFullU | Eigen::ComputeFullV);
+        Eigen::Map<Matrix3>(u_ptr + b * 9) = svd.matrixU();
+        Eigen::Map<Vector3>(s_ptr + b * 3) = svd.singularValues();
+        Eigen::Map<Matrix3>(v_ptr + b * 9) = svd.matrixV();
+    }
+}
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    DISPATCH_DTYPE_TO_TEMPLATE(lhs.GetDtype(), [&]() {
+        MatmulCPUKernel<scalar_t>(lhs, rhs, dst);
+    });
+}
+
+void InverseCPU(const Tensor& src, Tensor& dst) {
+    if (src.GetDtype() == Dtype::Float32) {
+        InverseCPUKernel<float>(src, dst);
+    } else {
+        InverseCPUKernel<double>(src, dst);
+    }
+}
+
+void SolveCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    if (lhs.GetDtype() == Dtype::Float32) {
+        SolveCPUKernel<float>(lhs, rhs, dst);
+    } else {
+        SolveCPUKernel<double>(lhs, rhs, dst);
+    }
+}
+
+void SVD3x3CPU(const Tensor& src, Tensor& u, Tensor& s, Tensor& v) {
+    if (src.GetDtype() == Dtype::Float32) {
+        SVD3x3CPUKernel<float>(src, u, s, v);
+    } else {
+        SVD3x3CPUKernel<double>(src, u, s, v);
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
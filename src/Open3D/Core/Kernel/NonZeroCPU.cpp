@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/NonZero.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Elements are compacted in chunks of this size, one task per chunk.
+static constexpr int64_t NONZERO_CHUNK_SIZE = 1 << 15;
+
+/// Two-pass compaction: each chunk first counts its non-zeros, a prefix sum
+/// over the counts gives every chunk its output offset, and the chunks then
+/// write their indices independently.
+template <typename scalar_t>
+static Tensor NonZeroCPUImpl(const Tensor& src) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    const SizeVector& shape = src.GetShape();
+    int64_t num_dims = src.NumDims();
+    int64_t num_elements = src.NumElements();
+    int64_t num_chunks =
+            (num_elements + NONZERO_CHUNK_SIZE - 1) / NONZERO_CHUNK_SIZE;
+    auto is_non_zero = [](scalar_t value) {
+        return value != static_cast<scalar_t>(0);
+    };
+
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (num_chunks > 1)
+#endif
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t end = std::min(num_elements, (c + 1) * NONZERO_CHUNK_SIZE);
+        int64_t count = 0;
+        for (int64_t i = c * NONZERO_CHUNK_SIZE; i < end; ++i) {
+            count += is_non_zero(src_ptr[i]);
+        }
+        chunk_offsets[c + 1] = count;
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        chunk_offsets[c + 1] += chunk_offsets[c];
+    }
+    int64_t num_non_zeros = chunk_offsets[num_chunks];
+
+    Tensor dst({num_dims, num_non_zeros}, Dtype::Int64, src.GetDevice());
+    int64_t* dst_ptr = static_cast<int64_t*>(dst.GetDataPtr());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (num_chunks > 1)
+#endif
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t end = std::min(num_elements, (c + 1) * NONZERO_CHUNK_SIZE);
+        int64_t k = chunk_offsets[c];
+        for (int64_t i = c * NONZERO_CHUNK_SIZE; i < end; ++i) {
+            if (!is_non_zero(src_ptr[i])) {
+                continue;
+            }
+            int64_t remainder = i;
+            for (int64_t d = num_dims - 1; d >= 0; --d) {
+                dst_ptr[d * num_non_zeros + k] = remainder % shape[d];
+                remainder /= shape[d];
+            }
+            ++k;
+        }
+    }
+    return dst;
+}
+
+Tensor NonZeroCPU(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor dst;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        dst = NonZeroCPUImpl<scalar_t>(src_contiguous);
+    });
+    return dst;
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -25,11 +25,31 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Core/Kernel/Reduction.h"
+#include "Open3D/Core/KernelProfiler.h"
 #include "Open3D/Core/SizeVector.h"
 
 namespace open3d {
 namespace kernel {
 
+static const char* GetReductionOpName(ReductionOpCode op_code) {
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            return "Reduction::Sum";
+        case ReductionOpCode::Prod:
+            return "Reduction::Prod";
+        case ReductionOpCode::Min:
+            return "Reduction::Min";
+        case ReductionOpCode::Max:
+            return "Reduction::Max";
+        case ReductionOpCode::ArgMin:
+            return "Reduction::ArgMin";
+        case ReductionOpCode::ArgMax:
+            return "Reduction::ArgMax";
+        default:
+            return "Reduction";
+    }
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
@@ -86,17 +106,36 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    // Half-precision sums and products are accumulated in float32. Min, Max
+    // and the arg-reductions are exact in half precision.
+    if (src.GetDtype() == Dtype::Float16 &&
+        (op_code == ReductionOpCode::Sum || op_code == ReductionOpCode::Prod)) {
+        Tensor dst_float =
+                Tensor::Empty(keepdim_shape, Dtype::Float32, dst.GetDevice());
+        Reduction(src.To(Dtype::Float32), dst_float, dims, true, op_code);
+        dst.AsRvalue() = dst_float;
+        if (!keepdim) {
+            dst = dst.Reshape(non_keepdim_shape);
+        }
+        return;
+    }
+
     Device::DeviceType device_type = src.GetDevice().GetType();
-    if (device_type == Device::DeviceType::CPU) {
-        ReductionCPU(src, dst, dims, keepdim, op_code);
-    } else if (device_type == Device::DeviceType::CUDA) {
+    {
+        KernelProfileScope profile_scope(GetReductionOpName(op_code), src,
+                                         dst);
+        if (device_type == Device::DeviceType::CPU) {
+            ReductionCPU(src, dst, dims, keepdim, op_code);
+        } else if (device_type == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        ReductionCUDA(src, dst, dims, keepdim, op_code);
+            ReductionCUDA(src, dst, dims, keepdim, op_code);
 #else
-        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
 #endif
-    } else {
-        utility::LogError("Unimplemented device.");
+        } else {
+            utility::LogError("Unimplemented device.");
+        }
     }
 
     if (!keepdim) {
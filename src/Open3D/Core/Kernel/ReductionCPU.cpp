@@ -26,7 +26,10 @@
 
 #include "Open3D/Core/Kernel/Reduction.h"
 
+#include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Indexer.h"
@@ -77,6 +80,66 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Strided loop nest over the input and output of a single-output reduction.
+/// Only dims of size > 1 are kept and they are sorted by input stride, such
+/// that dim 0 is the innermost loop. Strides are in elements. Reduction dims
+/// have output stride 0.
+template <typename scalar_t>
+struct CPUReductionBlock {
+    CPUReductionBlock(const Indexer& indexer) {
+        src_ = reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(0, 0));
+        dst_ = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0, 0));
+        const TensorRef& src_ref = indexer.GetInput(0);
+        const TensorRef& dst_ref = indexer.GetOutput(0);
+        ndims_ = 0;
+        for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+            if (indexer.GetMasterShape()[dim] > 1) {
+                shape_[ndims_] = indexer.GetMasterShape()[dim];
+                src_strides_[ndims_] =
+                        src_ref.byte_strides_[dim] / src_ref.dtype_byte_size_;
+                dst_strides_[ndims_] =
+                        dst_ref.byte_strides_[dim] / dst_ref.dtype_byte_size_;
+                ndims_++;
+            }
+        }
+        // Insertion sort by input stride, output stride as tie breaker.
+        auto is_inner = [&](int64_t dim0, int64_t dim1) {
+            return src_strides_[dim0] < src_strides_[dim1] ||
+                   (src_strides_[dim0] == src_strides_[dim1] &&
+                    dst_strides_[dim0] < dst_strides_[dim1]);
+        };
+        for (int64_t i = 1; i < ndims_; ++i) {
+            for (int64_t j = i; j > 0 && is_inner(j, j - 1); --j) {
+                std::swap(shape_[j], shape_[j - 1]);
+                std::swap(src_strides_[j], src_strides_[j - 1]);
+                std::swap(dst_strides_[j], dst_strides_[j - 1]);
+            }
+        }
+    }
+
+    int64_t NumWorkloads() const {
+        int64_t num_workloads = 1;
+        for (int64_t dim = 0; dim < ndims_; ++dim) {
+            num_workloads *= shape_[dim];
+        }
+        return num_workloads;
+    }
+
+    /// Restricts \p dim to [start, start + size).
+    void ShrinkDim(int64_t dim, int64_t start, int64_t size) {
+        src_ += start * src_strides_[dim];
+        dst_ += start * dst_strides_[dim];
+        shape_[dim] = size;
+    }
+
+    const scalar_t* src_;
+    scalar_t* dst_;
+    int64_t ndims_;
+    int64_t shape_[MAX_DIMS];
+    int64_t src_strides_[MAX_DIMS];
+    int64_t dst_strides_[MAX_DIMS];
+};
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -85,106 +148,276 @@ public:
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
-        // See: PyTorch's TensorIterator::parallel_reduce for the reference
-        // design of reduction strategy.
-        if (parallel_util::GetMaxThreads() == 1 ||
-            parallel_util::InParallel()) {
-            LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
-        } else if (indexer_.NumOutputElements() <= 1) {
-            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
+        if (indexer_.NumWorkloads() == 0) {
+            return;
+        }
+        CPUReductionBlock<scalar_t> block(indexer_);
+        int64_t num_threads = parallel_util::GetMaxThreads();
+        if (num_threads == 1 || parallel_util::InParallel() ||
+            block.NumWorkloads() < REDUCTION_PARALLEL_GRAIN_SIZE) {
+            ReduceBlock(block, reduce_func, identity);
+            return;
+        }
+
+        // Largest non-reduction dim and largest reduction dim.
+        int64_t output_dim = -1;
+        int64_t reduction_dim = -1;
+        for (int64_t dim = 0; dim < block.ndims_; ++dim) {
+            int64_t& best_dim =
+                    block.dst_strides_[dim] == 0 ? reduction_dim : output_dim;
+            if (best_dim == -1 || block.shape_[dim] > block.shape_[best_dim]) {
+                best_dim = dim;
+            }
+        }
+        int64_t num_outputs = indexer_.NumOutputElements();
+
+        if (output_dim != -1 &&
+            (reduction_dim == -1 || block.shape_[output_dim] >= num_threads ||
+             num_outputs * num_threads > block.NumWorkloads())) {
+            // Each thread reduces a block of rows into its own outputs.
+            LaunchOutputParallel(block, output_dim, reduce_func, identity);
         } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
+            // Each thread reduces a slice of the reduction dim into private
+            // outputs, which are reduced into dst in the end.
+            LaunchReductionParallel(block, reduction_dim, num_outputs,
+                                    reduce_func, identity);
         }
     }
 
 private:
+    /// Below this number of input elements, reductions run serially.
+    static constexpr int64_t REDUCTION_PARALLEL_GRAIN_SIZE = 32768;
+
+    /// Number of independent accumulators when reducing a row, to break the
+    /// dependency chain and allow vectorization.
+    static constexpr int64_t NUM_ROW_ACCUMULATORS = 8;
+
+    /// Rows shorter than this are grouped into blocks of contiguous rows.
+    static constexpr int64_t ROW_BLOCK_SIZE = 64;
+
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelSerial(const Indexer& indexer,
-                                            func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
+    static void LaunchOutputParallel(const CPUReductionBlock<scalar_t>& block,
+                                     int64_t output_dim,
+                                     const func_t& reduce_func,
+                                     scalar_t identity) {
+        int64_t dim_size = block.shape_[output_dim];
+        int64_t num_chunks =
+                std::min<int64_t>(parallel_util::GetMaxThreads(), dim_size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            int64_t start = dim_size * chunk_idx / num_chunks;
+            int64_t end = dim_size * (chunk_idx + 1) / num_chunks;
+            CPUReductionBlock<scalar_t> chunk(block);
+            chunk.ShrinkDim(output_dim, start, end - start);
+            ReduceBlock(chunk, reduce_func, identity);
         }
     }
 
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelTwoPass(const Indexer& indexer,
-                                             func_t element_kernel,
-                                             scalar_t identity) {
-        if (indexer.NumOutputElements() > 1) {
-            utility::LogError(
-                    "Internal error: two-pass reduction only works for "
-                    "single-output reduction ops.");
+    static void LaunchReductionParallel(
+            const CPUReductionBlock<scalar_t>& block,
+            int64_t reduction_dim,
+            int64_t num_outputs,
+            const func_t& reduce_func,
+            scalar_t identity) {
+        int64_t dim_size = block.shape_[reduction_dim];
+        int64_t num_chunks =
+                std::min<int64_t>(parallel_util::GetMaxThreads(), dim_size);
+
+        // Private outputs are contiguous over the non-reduction dims.
+        CPUReductionBlock<scalar_t> private_block(block);
+        int64_t private_stride = 1;
+        for (int64_t dim = 0; dim < block.ndims_; ++dim) {
+            if (block.dst_strides_[dim] != 0) {
+                private_block.dst_strides_[dim] = private_stride;
+                private_stride *= block.shape_[dim];
+            }
         }
-        int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = parallel_util::GetMaxThreads();
-        int64_t workload_per_thread =
-                (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
+        std::vector<scalar_t> private_outputs(num_chunks * num_outputs,
+                                              identity);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            int64_t start = dim_size * chunk_idx / num_chunks;
+            int64_t end = dim_size * (chunk_idx + 1) / num_chunks;
+            CPUReductionBlock<scalar_t> chunk(private_block);
+            chunk.dst_ = private_outputs.data() + chunk_idx * num_outputs;
+            chunk.ShrinkDim(reduction_dim, start, end - start);
+            ReduceBlock(chunk, reduce_func, identity);
+        }
+
+        // Reduce the private outputs into dst, iterating the non-reduction
+        // dims only.
+        CPUReductionBlock<scalar_t> combine_block(block);
+        combine_block.ndims_ = 0;
+        for (int64_t dim = 0; dim < block.ndims_; ++dim) {
+            if (block.dst_strides_[dim] != 0) {
+                int64_t combine_dim = combine_block.ndims_++;
+                combine_block.shape_[combine_dim] = block.shape_[dim];
+                combine_block.src_strides_[combine_dim] =
+                        private_block.dst_strides_[dim];
+                combine_block.dst_strides_[combine_dim] =
+                        block.dst_strides_[dim];
             }
         }
-        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            *dst = element_kernel(thread_results[thread_idx], *dst);
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            combine_block.src_ =
+                    private_outputs.data() + chunk_idx * num_outputs;
+            ReduceBlock(combine_block, reduce_func, identity);
         }
     }
 
+    /// Serially reduces \p block into its outputs. The two innermost dims are
+    /// handled by specialized loops, the remaining dims by an odometer.
     template <typename scalar_t, typename func_t>
-    static void LaunchReductionParallelDim(const Indexer& indexer,
-                                           func_t element_kernel) {
-        // Prefers outer dimension >= num_threads.
-        const int64_t* indexer_shape = indexer.GetMasterShape();
-        const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = parallel_util::GetMaxThreads();
+    static void ReduceBlock(const CPUReductionBlock<scalar_t>& block,
+                            const func_t& reduce_func,
+                            scalar_t identity) {
+        const int64_t ndims = block.ndims_;
+        const int64_t n0 = ndims > 0 ? block.shape_[0] : 1;
+        const int64_t src_s0 = ndims > 0 ? block.src_strides_[0] : 0;
+        const int64_t dst_s0 = ndims > 0 ? block.dst_strides_[0] : 0;
+        const int64_t n1 = ndims > 1 ? block.shape_[1] : 1;
+        const int64_t src_s1 = ndims > 1 ? block.src_strides_[1] : 0;
+        const int64_t dst_s1 = ndims > 1 ? block.dst_strides_[1] : 0;
 
-        // Init best_dim as the outer-most non-reduction dim.
-        int64_t best_dim = num_dims - 1;
-        while (best_dim >= 0 && indexer.IsReductionDim(best_dim)) {
-            best_dim--;
+        int64_t num_outer = 1;
+        for (int64_t dim = 2; dim < ndims; ++dim) {
+            num_outer *= block.shape_[dim];
         }
-        for (int64_t dim = best_dim; dim >= 0 && !indexer.IsReductionDim(dim);
-             --dim) {
-            if (indexer_shape[dim] >= num_threads) {
-                best_dim = dim;
-                break;
-            } else if (indexer_shape[dim] > indexer_shape[best_dim]) {
-                best_dim = dim;
+        int64_t index[MAX_DIMS] = {0};
+        const scalar_t* src = block.src_;
+        scalar_t* dst = block.dst_;
+        for (int64_t outer_idx = 0; outer_idx < num_outer; ++outer_idx) {
+            ReduceTile(src, dst, n0, src_s0, dst_s0, n1, src_s1, dst_s1,
+                       reduce_func, identity);
+            // Advance the odometer over dims >= 2.
+            for (int64_t dim = 2; dim < ndims; ++dim) {
+                src += block.src_strides_[dim];
+                dst += block.dst_strides_[dim];
+                if (++index[dim] < block.shape_[dim]) {
+                    break;
+                }
+                src -= block.src_strides_[dim] * block.shape_[dim];
+                dst -= block.dst_strides_[dim] * block.shape_[dim];
+                index[dim] = 0;
             }
         }
-        if (best_dim == -1) {
-            utility::LogError(
-                    "Internal error: all dims are reduction dims, use "
-                    "LaunchReductionKernelTwoPass instead.");
+    }
+
+    /// Reduces an n1 x n0 tile, where dim 0 is the inner loop.
+    template <typename scalar_t, typename func_t>
+    static void ReduceTile(const scalar_t* src,
+                           scalar_t* dst,
+                           int64_t n0,
+                           int64_t src_s0,
+                           int64_t dst_s0,
+                           int64_t n1,
+                           int64_t src_s1,
+                           int64_t dst_s1,
+                           const func_t& reduce_func,
+                           scalar_t identity) {
+        if (dst_s0 == 0 && n0 < NUM_ROW_ACCUMULATORS) {
+            // Short rows, e.g. Sum({1}) of an (N, 3) tensor: loop over the
+            // rows in the inner loop instead.
+            for (int64_t i = 0; i < n0; ++i) {
+                const scalar_t* col_src = src + i * src_s0;
+                for (int64_t j = 0; j < n1; ++j) {
+                    dst[j * dst_s1] =
+                            reduce_func(col_src[j * src_s1], dst[j * dst_s1]);
+                }
+            }
+        } else if (dst_s0 == 0) {
+            // Reduce along the inner dim: each row has a single output.
+            for (int64_t j = 0; j < n1; ++j) {
+                scalar_t* row_dst = dst + j * dst_s1;
+                *row_dst = reduce_func(
+                        ReduceRow(src + j * src_s1, n0, src_s0, reduce_func,
+                                  identity),
+                        *row_dst);
+            }
+        } else if (src_s0 == 1 && dst_s0 == 1 && dst_s1 == 0 &&
+                   src_s1 == n0 && n0 < ROW_BLOCK_SIZE) {
+            // Short contiguous rows reduced into the same output row, e.g.
+            // Sum({0}) of an (N, 3) tensor. Blocks of rows are accumulated as
+            // one contiguous vector, and the row accumulators are reduced
+            // into dst in the end.
+            int64_t rows_per_block = ROW_BLOCK_SIZE / n0;
+            int64_t block_size = rows_per_block * n0;
+            scalar_t acc[ROW_BLOCK_SIZE];
+            std::fill(acc, acc + block_size, identity);
+            int64_t j = 0;
+            for (; j + rows_per_block <= n1; j += rows_per_block) {
+                const scalar_t* block_src = src + j * n0;
+                for (int64_t i = 0; i < block_size; ++i) {
+                    acc[i] = reduce_func(block_src[i], acc[i]);
+                }
+            }
+            for (; j < n1; ++j) {
+                for (int64_t i = 0; i < n0; ++i) {
+                    acc[i] = reduce_func(src[j * n0 + i], acc[i]);
+                }
+            }
+            for (int64_t r = 0; r < rows_per_block; ++r) {
+                for (int64_t i = 0; i < n0; ++i) {
+                    dst[i] = reduce_func(acc[r * n0 + i], dst[i]);
+                }
+            }
+        } else if (src_s0 == 1 && dst_s0 == 1) {
+            for (int64_t j = 0; j < n1; ++j) {
+                const scalar_t* row_src = src + j * src_s1;
+                scalar_t* row_dst = dst + j * dst_s1;
+                for (int64_t i = 0; i < n0; ++i) {
+                    row_dst[i] = reduce_func(row_src[i], row_dst[i]);
+                }
+            }
+        } else {
+            for (int64_t j = 0; j < n1; ++j) {
+                const scalar_t* row_src = src + j * src_s1;
+                scalar_t* row_dst = dst + j * dst_s1;
+                for (int64_t i = 0; i < n0; ++i) {
+                    row_dst[i * dst_s0] = reduce_func(row_src[i * src_s0],
+                                                      row_dst[i * dst_s0]);
+                }
+            }
         }
+    }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+    /// Reduces \p n elements with \p stride using independent accumulators.
+    template <typename scalar_t, typename func_t>
+    static scalar_t ReduceRow(const scalar_t* src,
+                              int64_t n,
+                              int64_t stride,
+                              const func_t& reduce_func,
+                              scalar_t identity) {
+        scalar_t acc[NUM_ROW_ACCUMULATORS];
+        std::fill(acc, acc + NUM_ROW_ACCUMULATORS, identity);
+        int64_t i = 0;
+        if (stride == 1) {
+            for (; i + NUM_ROW_ACCUMULATORS <= n; i += NUM_ROW_ACCUMULATORS) {
+                for (int64_t k = 0; k < NUM_ROW_ACCUMULATORS; ++k) {
+                    acc[k] = reduce_func(src[i + k], acc[k]);
+                }
+            }
+        } else {
+            for (; i + NUM_ROW_ACCUMULATORS <= n; i += NUM_ROW_ACCUMULATORS) {
+                for (int64_t k = 0; k < NUM_ROW_ACCUMULATORS; ++k) {
+                    acc[k] = reduce_func(src[(i + k) * stride], acc[k]);
+                }
+            }
+        }
+        for (; i < n; ++i) {
+            acc[0] = reduce_func(src[i * stride], acc[0]);
+        }
+        scalar_t result = acc[0];
+        for (int64_t k = 1; k < NUM_ROW_ACCUMULATORS; ++k) {
+            result = reduce_func(acc[k], result);
         }
+        return result;
     }
 
 private:
@@ -203,34 +436,87 @@ public:
         // sub-iterations. Each output elemnent corresponds to multiple input
         // elements. We need to keep track of the indices within each
         // sub-iteration.
-        int64_t num_input_elements = indexer_.NumWorkloads();
         int64_t num_output_elements = indexer_.NumOutputElements();
-        int64_t ipo =
-                num_input_elements / num_output_elements;  // Inputs per output
+        int64_t num_threads = parallel_util::GetMaxThreads();
 
+        if (num_output_elements >= num_threads ||
+            parallel_util::InParallel()) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int64_t output_idx = 0; output_idx < num_output_elements;
+                 output_idx++) {
+                // sub_indexer.NumWorkloads() == ipo.
+                // sub_indexer's workload_idx is indexer_'s ipo_idx.
+                Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
+                WriteResult<scalar_t>(
+                        sub_indexer,
+                        ReduceRange<scalar_t>(sub_indexer, 0,
+                                              sub_indexer.NumWorkloads(),
+                                              reduce_func));
+            }
+        } else {
+            // Few outputs, e.g. ArgMax over all elements: split the inputs of
+            // each output among threads and reduce the per-thread results in
+            // order, such that ties resolve to the first index.
+            for (int64_t output_idx = 0; output_idx < num_output_elements;
+                 output_idx++) {
+                Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
+                int64_t ipo = sub_indexer.NumWorkloads();
+                int64_t num_chunks = std::min(num_threads, ipo);
+                std::vector<std::pair<int64_t, scalar_t>> chunk_results(
+                        num_chunks);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
-            // sub_indexer.NumWorkloads() == ipo.
-            // sub_indexer's workload_idx is indexer_'s ipo_idx.
-            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+                for (int64_t chunk_idx = 0; chunk_idx < num_chunks;
+                     ++chunk_idx) {
+                    chunk_results[chunk_idx] = ReduceRange<scalar_t>(
+                            sub_indexer, ipo * chunk_idx / num_chunks,
+                            ipo * (chunk_idx + 1) / num_chunks, reduce_func);
+                }
+                std::pair<int64_t, scalar_t> result = chunk_results[0];
+                for (int64_t chunk_idx = 1; chunk_idx < num_chunks;
+                     ++chunk_idx) {
+                    result = reduce_func(chunk_results[chunk_idx].first,
+                                         chunk_results[chunk_idx].second,
+                                         result.first, result.second);
+                }
+                WriteResult<scalar_t>(sub_indexer, result);
             }
         }
     }
 
 private:
+    /// Returns the index and value of the arg-reduction over workloads
+    /// [start, end) of \p sub_indexer, which must be non-empty.
+    template <typename scalar_t, typename func_t>
+    static std::pair<int64_t, scalar_t> ReduceRange(const Indexer& sub_indexer,
+                                                    int64_t start,
+                                                    int64_t end,
+                                                    const func_t& reduce_func) {
+        std::pair<int64_t, scalar_t> result(
+                start, *reinterpret_cast<scalar_t*>(
+                               sub_indexer.GetInputPtr(0, start)));
+        for (int64_t workload_idx = start + 1; workload_idx < end;
+             workload_idx++) {
+            scalar_t src_val = *reinterpret_cast<scalar_t*>(
+                    sub_indexer.GetInputPtr(0, workload_idx));
+            result = reduce_func(workload_idx, src_val, result.first,
+                                 result.second);
+        }
+        return result;
+    }
+
+    template <typename scalar_t>
+    static void WriteResult(const Indexer& sub_indexer,
+                            const std::pair<int64_t, scalar_t>& result) {
+        *reinterpret_cast<int64_t*>(sub_indexer.GetOutputPtr(0, 0)) =
+                result.first;
+        *reinterpret_cast<scalar_t*>(sub_indexer.GetOutputPtr(1, 0)) =
+                result.second;
+    }
+
     Indexer indexer_;
 };
 
@@ -271,7 +557,7 @@ void ReductionCPU(const Tensor& src,
                         utility::LogError(
                                 "Zero-size Tensor does not suport Max.");
                     } else {
-                        identity = std::numeric_limits<scalar_t>::min();
+                        identity = std::numeric_limits<scalar_t>::lowest();
                         dst.Fill(identity);
                         re.Run(CPUMaxReductionKernel<scalar_t>, identity);
                     }
@@ -310,7 +596,7 @@ void ReductionCPU(const Tensor& src,
                         utility::LogError(
                                 "Zero-size Tensor does not suport ArgMax.");
                     } else {
-                        identity = std::numeric_limits<scalar_t>::min();
+                        identity = std::numeric_limits<scalar_t>::lowest();
                         dst_acc.Fill(identity);
                         re.Run(CPUArgMaxReductionKernel<scalar_t>, identity);
                     }
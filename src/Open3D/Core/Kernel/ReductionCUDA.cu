@@ -87,6 +87,17 @@ OPEN3D_DEVICE __forceinline__ T WARP_SHFL_DOWN(T value,
 #endif
 }
 
+// Float16 is shuffled through its bit pattern.
+OPEN3D_DEVICE __forceinline__ open3d::Float16 WARP_SHFL_DOWN(
+        open3d::Float16 value,
+        unsigned int delta,
+        int width = warpSize,
+        unsigned int mask = 0xffffffff) {
+    unsigned int bits = value.bits_;
+    return open3d::Float16::FromBits(
+            static_cast<uint16_t>(WARP_SHFL_DOWN(bits, delta, width, mask)));
+}
+
 namespace open3d {
 namespace kernel {
 
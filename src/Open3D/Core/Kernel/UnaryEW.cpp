@@ -26,6 +26,7 @@
 
 #include "Open3D/Core/Kernel/UnaryEW.h"
 
+#include "Open3D/Core/KernelProfiler.h"
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -33,6 +34,27 @@
 namespace open3d {
 namespace kernel {
 
+static const char* GetUnaryEWOpName(UnaryEWOpCode op_code) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            return "UnaryEW::Sqrt";
+        case UnaryEWOpCode::Sin:
+            return "UnaryEW::Sin";
+        case UnaryEWOpCode::Cos:
+            return "UnaryEW::Cos";
+        case UnaryEWOpCode::Neg:
+            return "UnaryEW::Neg";
+        case UnaryEWOpCode::Exp:
+            return "UnaryEW::Exp";
+        case UnaryEWOpCode::Abs:
+            return "UnaryEW::Abs";
+        case UnaryEWOpCode::LogicalNot:
+            return "UnaryEW::LogicalNot";
+        default:
+            return "UnaryEW";
+    }
+}
+
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
@@ -48,6 +70,7 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    KernelProfileScope profile_scope(GetUnaryEWOpName(op_code), src, dst);
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
@@ -77,6 +100,7 @@ void Copy(const Tensor& src, Tensor& dst) {
          dst_device_type != Device::DeviceType::CUDA)) {
         utility::LogError("Copy: Unimplemented device");
     }
+    KernelProfileScope profile_scope("Copy", src, dst);
     if (src_device_type == Device::DeviceType::CPU &&
         dst_device_type == Device::DeviceType::CPU) {
         CopyCPU(src, dst);
@@ -104,7 +104,7 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
-                CPULauncher::LaunchUnaryEWKernel(
+                CPULauncher::LaunchUnaryEWKernel<src_t, dst_t>(
                         indexer, CPUCopyElementKernel<src_t, dst_t>);
             });
         });
@@ -118,9 +118,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Indexer indexer({src}, dst, DtypePolicy::ASSERT_SAME_OR_BOOL_OUT);
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     DtypeUtil::ToString(dtype));
         }
     };
@@ -130,7 +132,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
-                CPULauncher::LaunchUnaryEWKernel(
+                CPULauncher::LaunchUnaryEWKernel<src_t, dst_t>(
                         indexer, CPULogicalNotElementKernel<src_t, dst_t>);
             });
         });
@@ -139,30 +141,30 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUSqrtElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUSinElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUCosElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Neg:
-                    CPULauncher::LaunchUnaryEWKernel(
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUNegElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUExpElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Abs:
-                    CPULauncher::LaunchUnaryEWKernel(
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t, scalar_t>(
                             indexer, CPUAbsElementKernel<scalar_t>);
                     break;
                 default:
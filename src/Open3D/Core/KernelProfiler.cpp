@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/KernelProfiler.h"
+
+#include <json/json.h>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+
+/// Events kept by default, about 10 MB.
+constexpr size_t DEFAULT_KERNEL_EVENT_CAPACITY = 1 << 16;
+
+class KernelEventBuffer {
+public:
+    static KernelEventBuffer& GetInstance() {
+        static KernelEventBuffer instance;
+        return instance;
+    }
+
+    void SetCapacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.clear();
+        events_.resize(capacity);
+        head_ = 0;
+        size_ = 0;
+    }
+
+    size_t GetCapacity() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return events_.size();
+    }
+
+    void Push(const KernelEvent& event) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (events_.empty()) {
+            return;
+        }
+        events_[(head_ + size_) % events_.size()] = event;
+        if (size_ < events_.size()) {
+            size_++;
+        } else {
+            head_ = (head_ + 1) % events_.size();
+        }
+    }
+
+    std::vector<KernelEvent> GetEvents() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<KernelEvent> events;
+        events.reserve(size_);
+        for (size_t i = 0; i < size_; ++i) {
+            events.push_back(events_[(head_ + i) % events_.size()]);
+        }
+        return events;
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        head_ = 0;
+        size_ = 0;
+    }
+
+private:
+    KernelEventBuffer() : events_(DEFAULT_KERNEL_EVENT_CAPACITY) {}
+
+    std::mutex mutex_;
+    std::vector<KernelEvent> events_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
+
+double GetTimeInMicroseconds(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration<double, std::micro>(time.time_since_epoch())
+            .count();
+}
+
+int GetThreadId() {
+    static std::atomic<int> next_thread_id(0);
+    thread_local int thread_id = next_thread_id++;
+    return thread_id;
+}
+
+}  // unnamed namespace
+
+std::atomic<bool> KernelProfiler::enabled_(false);
+
+void KernelProfiler::Enable() { enabled_ = true; }
+
+void KernelProfiler::Disable() { enabled_ = false; }
+
+void KernelProfiler::SetCapacity(size_t capacity) {
+    KernelEventBuffer::GetInstance().SetCapacity(capacity);
+}
+
+size_t KernelProfiler::GetCapacity() {
+    return KernelEventBuffer::GetInstance().GetCapacity();
+}
+
+void KernelProfiler::Record(const KernelEvent& event) {
+    KernelEventBuffer::GetInstance().Push(event);
+}
+
+std::vector<KernelEvent> KernelProfiler::GetEvents() {
+    return KernelEventBuffer::GetInstance().GetEvents();
+}
+
+void KernelProfiler::Clear() { KernelEventBuffer::GetInstance().Clear(); }
+
+std::string KernelProfiler::ToChromeTrace() {
+    Json::Value trace_events(Json::arrayValue);
+    for (const KernelEvent& event : GetEvents()) {
+        Json::Value shapes(Json::arrayValue);
+        for (const SizeVector& shape : event.shapes_) {
+            shapes.append(shape.ToString());
+        }
+        Json::Value args;
+        args["device"] = event.device_.ToString();
+        args["dtype"] = DtypeUtil::ToString(event.dtype_);
+        args["shapes"] = shapes;
+        args["bytes"] = Json::Int64(event.bytes_);
+        args["num_threads"] = event.num_threads_;
+
+        // A complete event ("ph": "X") has a start time and a duration.
+        Json::Value trace_event;
+        trace_event["name"] = event.name_;
+        trace_event["cat"] = "kernel";
+        trace_event["ph"] = "X";
+        trace_event["ts"] = event.start_us_;
+        trace_event["dur"] = event.duration_us_;
+        trace_event["pid"] = 0;
+        trace_event["tid"] = event.thread_id_;
+        trace_event["args"] = args;
+        trace_events.append(trace_event);
+    }
+    Json::Value root;
+    root["traceEvents"] = trace_events;
+    root["displayTimeUnit"] = "ms";
+
+    Json::StreamWriterBuilder builder;
+    builder["commentStyle"] = "None";
+    builder["indentation"] = "";
+    return Json::writeString(builder, root);
+}
+
+bool KernelProfiler::WriteChromeTrace(const std::string& filename) {
+    std::ofstream file_out(filename);
+    if (!file_out.is_open()) {
+        utility::LogWarning("Write Chrome trace failed: unable to open file {}",
+                            filename);
+        return false;
+    }
+    file_out << ToChromeTrace();
+    return true;
+}
+
+void KernelProfileScope::Start(const char* name,
+                               std::initializer_list<const Tensor*> tensors) {
+    event_.name_ = name;
+    for (const Tensor* tensor : tensors) {
+        event_.shapes_.push_back(tensor->GetShape());
+        event_.bytes_ += tensor->NumElements() *
+                         DtypeUtil::ByteSize(tensor->GetDtype());
+    }
+    if (tensors.size() > 0) {
+        event_.device_ = (*tensors.begin())->GetDevice();
+        event_.dtype_ = (*tensors.begin())->GetDtype();
+    }
+    event_.num_threads_ = kernel::parallel_util::GetMaxThreads();
+    event_.thread_id_ = GetThreadId();
+    start_time_ = std::chrono::steady_clock::now();
+}
+
+void KernelProfileScope::Stop() {
+    std::chrono::steady_clock::time_point end_time =
+            std::chrono::steady_clock::now();
+    event_.start_us_ = GetTimeInMicroseconds(start_time_);
+    event_.duration_us_ = GetTimeInMicroseconds(end_time) - event_.start_us_;
+    KernelProfiler::Record(event_);
+}
+
+}  // namespace open3d
@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// A Tensor kernel launch recorded by the KernelProfiler.
+struct KernelEvent {
+    /// Op name, e.g. "BinaryEW::Add".
+    std::string name_;
+    Device device_;
+    /// Dtype of the first input.
+    Dtype dtype_ = Dtype::Undefined;
+    /// Shapes of the inputs, followed by the shape of the output.
+    std::vector<SizeVector> shapes_;
+    /// Bytes read and written, counting every input and output element once.
+    int64_t bytes_ = 0;
+    /// Start time and duration in microseconds. The start time is relative to
+    /// an arbitrary process-wide epoch.
+    double start_us_ = 0;
+    double duration_us_ = 0;
+    /// Number of threads available to the kernel.
+    int num_threads_ = 1;
+    /// Small integer id of the calling thread.
+    int thread_id_ = 0;
+};
+
+/// KernelProfiler records Tensor kernel launches into a fixed-size ring
+/// buffer that can be exported in the Chrome trace event format, for viewing in
+/// chrome://tracing or Perfetto. It is disabled by default, in which case a
+/// kernel launch only pays for a relaxed atomic load.
+///
+/// ```cpp
+/// KernelProfiler::Enable();
+/// RunPipeline();
+/// KernelProfiler::Disable();
+/// KernelProfiler::WriteChromeTrace("kernels.json");
+/// ```
+class KernelProfiler {
+public:
+    static void Enable();
+    static void Disable();
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Sets the number of events kept. When the buffer is full, the oldest
+    /// events are overwritten. Clears the recorded events.
+    static void SetCapacity(size_t capacity);
+    static size_t GetCapacity();
+
+    /// Adds an event to the ring buffer. Thread-safe.
+    static void Record(const KernelEvent& event);
+
+    /// Returns the recorded events, oldest first.
+    static std::vector<KernelEvent> GetEvents();
+    static void Clear();
+
+    /// Returns the recorded events as a Chrome trace JSON string.
+    static std::string ToChromeTrace();
+    static bool WriteChromeTrace(const std::string& filename);
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+/// Records the enclosing kernel dispatch while the KernelProfiler is enabled.
+/// The tensors are the inputs of the kernel followed by its output.
+class KernelProfileScope {
+public:
+    template <typename... Tensors>
+    KernelProfileScope(const char* name, const Tensors&... tensors)
+        : enabled_(KernelProfiler::IsEnabled()) {
+        if (enabled_) {
+            Start(name, {&tensors...});
+        }
+    }
+
+    ~KernelProfileScope() {
+        if (enabled_) {
+            Stop();
+        }
+    }
+
+    KernelProfileScope(const KernelProfileScope&) = delete;
+    KernelProfileScope& operator=(const KernelProfileScope&) = delete;
+
+private:
+    void Start(const char* name, std::initializer_list<const Tensor*> tensors);
+    void Stop();
+
+    bool enabled_;
+    KernelEvent event_;
+    std::chrono::steady_clock::time_point start_time_;
+};
+
+}  // namespace open3d
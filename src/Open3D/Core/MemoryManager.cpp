@@ -92,6 +92,10 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::ReleaseCache(const Device& device) {
+    GetDeviceMemoryManager(device)->ReleaseCache();
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
@@ -99,7 +103,7 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
                               utility::hash_enum_class::hash>
             map_device_type_to_memory_manager = {
                     {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+                     CPUCachingMemoryManager::GetInstance()},
 #ifdef BUILD_CUDA_MODULE
                     {Device::DeviceType::CUDA,
                      std::make_shared<CUDAMemoryManager>()},
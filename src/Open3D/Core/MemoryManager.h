@@ -26,11 +26,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Open3D/Core/Device.h"
 
@@ -57,6 +60,9 @@ public:
                              const void* src_ptr,
                              const Device& src_device,
                              size_t num_bytes);
+    /// Releases the memory cached by the memory manager of \p device back to
+    /// the system. No-op for devices without caching.
+    static void ReleaseCache(const Device& device);
 
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
@@ -72,6 +78,8 @@ public:
                         const void* src_ptr,
                         const Device& src_device,
                         size_t num_bytes) = 0;
+    /// Releases cached memory, if the memory manager caches freed memory.
+    virtual void ReleaseCache() {}
 };
 
 class CPUMemoryManager : public DeviceMemoryManager {
@@ -86,6 +94,66 @@ public:
                 size_t num_bytes) override;
 };
 
+/// CPU memory manager with a size-class caching allocator, used as the default
+/// CPU memory manager.
+///
+/// Requested sizes are rounded up to size classes (4 classes per power of 2,
+/// minimum 64 bytes) and all blocks are 64-byte aligned. Freed blocks are kept
+/// in per-thread free lists of their size class and are reused by subsequent
+/// Malloc calls from the same thread, avoiding malloc/free and page faults for
+/// temporaries of recurring sizes. A freed block is returned to the system
+/// instead if caching it would exceed the high-water mark.
+class CPUCachingMemoryManager : public CPUMemoryManager {
+public:
+    /// Cache counters. Hits and misses count Malloc calls served from and
+    /// not served from the cache respectively.
+    struct Statistics {
+        int64_t num_hits_ = 0;
+        int64_t num_misses_ = 0;
+        int64_t bytes_cached_ = 0;
+        int64_t max_bytes_cached_ = 0;
+    };
+
+    static std::shared_ptr<CPUCachingMemoryManager> GetInstance();
+
+    CPUCachingMemoryManager(const CPUCachingMemoryManager&) = delete;
+    CPUCachingMemoryManager& operator=(const CPUCachingMemoryManager&) = delete;
+
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void ReleaseCache() override;
+
+    /// Sets the high-water mark of cached bytes summed over all threads.
+    /// Cached blocks are released if the cache exceeds the new limit. Setting
+    /// it to 0 disables caching.
+    void SetMaxBytesCached(int64_t max_bytes_cached);
+
+    Statistics GetStatistics() const;
+
+    void ResetStatistics();
+
+protected:
+    class ThreadCache;
+
+    CPUCachingMemoryManager();
+
+    ThreadCache* GetThreadCache();
+    void RegisterThreadCache(ThreadCache* thread_cache);
+    void UnregisterThreadCache(ThreadCache* thread_cache);
+
+    /// Frees all blocks in \p thread_cache. The caller must hold the
+    /// thread cache's lock.
+    void ReleaseThreadCache(ThreadCache* thread_cache);
+
+    std::atomic<int64_t> num_hits_;
+    std::atomic<int64_t> num_misses_;
+    std::atomic<int64_t> bytes_cached_;
+    std::atomic<int64_t> max_bytes_cached_;
+
+    std::mutex thread_caches_mutex_;
+    std::unordered_set<ThreadCache*> thread_caches_;
+};
+
 #ifdef BUILD_CUDA_MODULE
 class CUDAMemoryManager : public DeviceMemoryManager {
 public:
@@ -26,7 +26,10 @@
 
 #include "Open3D/Core/MemoryManager.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <vector>
 
 namespace open3d {
 
@@ -55,4 +58,217 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+namespace {
+
+/// Alignment of blocks returned by CPUCachingMemoryManager.
+constexpr int64_t kBlockAlignment = 64;
+/// 4 size classes for each power of 2 up to 2^63.
+constexpr int64_t kNumSizeClasses = 256;
+constexpr int64_t kDefaultMaxBytesCached = int64_t(1) << 30;
+
+/// Stored right before the aligned pointer returned to the user.
+struct BlockHeader {
+    void* raw_ptr_;
+    int64_t size_class_;
+};
+
+/// Set once the thread's cache has been destroyed at thread exit. Later
+/// allocations on that thread bypass the cache.
+thread_local bool tl_thread_cache_destroyed = false;
+
+/// Size classes split each interval (2^p, 2^(p+1)] into 4 equal steps,
+/// starting with the 64 byte class.
+int64_t GetSizeClass(size_t byte_size) {
+    int64_t size = std::max(static_cast<int64_t>(byte_size), kBlockAlignment);
+    int64_t p = 5;
+    while ((int64_t(1) << (p + 1)) < size) {
+        p++;
+    }
+    int64_t step = int64_t(1) << (p - 2);
+    int64_t k = (size + step - 1) / step;
+    return 4 * (p - 5) + (k - 5);
+}
+
+int64_t GetSizeClassByteSize(int64_t size_class) {
+    int64_t p = size_class / 4 + 5;
+    int64_t k = size_class % 4 + 5;
+    return k << (p - 2);
+}
+
+BlockHeader* GetBlockHeader(void* ptr) {
+    return reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) -
+                                          sizeof(BlockHeader));
+}
+
+void* AllocateBlock(int64_t size_class) {
+    size_t raw_byte_size = GetSizeClassByteSize(size_class) +
+                           sizeof(BlockHeader) + kBlockAlignment - 1;
+    void* raw_ptr = std::malloc(raw_byte_size);
+    if (!raw_ptr) {
+        utility::LogError("CPU malloc failed");
+    }
+    uintptr_t addr = (reinterpret_cast<uintptr_t>(raw_ptr) +
+                      sizeof(BlockHeader) + kBlockAlignment - 1) &
+                     ~static_cast<uintptr_t>(kBlockAlignment - 1);
+    void* ptr = reinterpret_cast<void*>(addr);
+    BlockHeader* header = GetBlockHeader(ptr);
+    header->raw_ptr_ = raw_ptr;
+    header->size_class_ = size_class;
+    return ptr;
+}
+
+void FreeBlock(void* ptr) { std::free(GetBlockHeader(ptr)->raw_ptr_); }
+
+}  // namespace
+
+/// Free lists of one thread. The lock is only contended by ReleaseCache
+/// calls from other threads.
+class CPUCachingMemoryManager::ThreadCache {
+public:
+    ThreadCache(const std::shared_ptr<CPUCachingMemoryManager>& manager)
+        : manager_(manager) {
+        manager_->RegisterThreadCache(this);
+    }
+
+    ~ThreadCache() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            manager_->ReleaseThreadCache(this);
+        }
+        manager_->UnregisterThreadCache(this);
+    }
+
+    std::mutex mutex_;
+    std::vector<void*> free_lists_[kNumSizeClasses];
+    /// Keeps the manager alive until all thread caches are released.
+    std::shared_ptr<CPUCachingMemoryManager> manager_;
+};
+
+CPUCachingMemoryManager::CPUCachingMemoryManager()
+    : num_hits_(0),
+      num_misses_(0),
+      bytes_cached_(0),
+      max_bytes_cached_(kDefaultMaxBytesCached) {}
+
+std::shared_ptr<CPUCachingMemoryManager>
+CPUCachingMemoryManager::GetInstance() {
+    static std::shared_ptr<CPUCachingMemoryManager> instance{
+            new CPUCachingMemoryManager};
+    return instance;
+}
+
+void* CPUCachingMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    int64_t size_class = GetSizeClass(byte_size);
+    ThreadCache* thread_cache = GetThreadCache();
+    if (thread_cache) {
+        std::lock_guard<std::mutex> lock(thread_cache->mutex_);
+        std::vector<void*>& free_list = thread_cache->free_lists_[size_class];
+        if (!free_list.empty()) {
+            void* ptr = free_list.back();
+            free_list.pop_back();
+            bytes_cached_ -= GetSizeClassByteSize(size_class);
+            num_hits_++;
+            return ptr;
+        }
+    }
+    num_misses_++;
+    return AllocateBlock(size_class);
+}
+
+void CPUCachingMemoryManager::Free(void* ptr, const Device& device) {
+    if (!ptr) {
+        return;
+    }
+    ThreadCache* thread_cache = GetThreadCache();
+    if (thread_cache) {
+        int64_t size_class = GetBlockHeader(ptr)->size_class_;
+        int64_t class_byte_size = GetSizeClassByteSize(size_class);
+        if (bytes_cached_.fetch_add(class_byte_size) + class_byte_size <=
+            max_bytes_cached_) {
+            std::lock_guard<std::mutex> lock(thread_cache->mutex_);
+            thread_cache->free_lists_[size_class].push_back(ptr);
+            return;
+        }
+        bytes_cached_ -= class_byte_size;
+    }
+    FreeBlock(ptr);
+}
+
+void CPUCachingMemoryManager::ReleaseCache() {
+    std::lock_guard<std::mutex> registry_lock(thread_caches_mutex_);
+    for (ThreadCache* thread_cache : thread_caches_) {
+        std::lock_guard<std::mutex> lock(thread_cache->mutex_);
+        ReleaseThreadCache(thread_cache);
+    }
+}
+
+void CPUCachingMemoryManager::SetMaxBytesCached(int64_t max_bytes_cached) {
+    if (max_bytes_cached < 0) {
+        utility::LogError("max_bytes_cached must be non-negative, but got {}",
+                          max_bytes_cached);
+    }
+    max_bytes_cached_ = max_bytes_cached;
+    if (bytes_cached_ > max_bytes_cached) {
+        ReleaseCache();
+    }
+}
+
+CPUCachingMemoryManager::Statistics CPUCachingMemoryManager::GetStatistics()
+        const {
+    Statistics statistics;
+    statistics.num_hits_ = num_hits_;
+    statistics.num_misses_ = num_misses_;
+    statistics.bytes_cached_ = bytes_cached_;
+    statistics.max_bytes_cached_ = max_bytes_cached_;
+    return statistics;
+}
+
+void CPUCachingMemoryManager::ResetStatistics() {
+    num_hits_ = 0;
+    num_misses_ = 0;
+}
+
+CPUCachingMemoryManager::ThreadCache*
+CPUCachingMemoryManager::GetThreadCache() {
+    // Destroys the thread's cache at thread exit, releasing its blocks.
+    struct ThreadCacheHolder {
+        ~ThreadCacheHolder() {
+            thread_cache_.reset();
+            tl_thread_cache_destroyed = true;
+        }
+        std::unique_ptr<ThreadCache> thread_cache_;
+    };
+    if (tl_thread_cache_destroyed) {
+        return nullptr;
+    }
+    thread_local ThreadCacheHolder holder;
+    if (!holder.thread_cache_) {
+        holder.thread_cache_.reset(new ThreadCache(GetInstance()));
+    }
+    return holder.thread_cache_.get();
+}
+
+void CPUCachingMemoryManager::RegisterThreadCache(ThreadCache* thread_cache) {
+    std::lock_guard<std::mutex> lock(thread_caches_mutex_);
+    thread_caches_.insert(thread_cache);
+}
+
+void CPUCachingMemoryManager::UnregisterThreadCache(
+        ThreadCache* thread_cache) {
+    std::lock_guard<std::mutex> lock(thread_caches_mutex_);
+    thread_caches_.erase(thread_cache);
+}
+
+void CPUCachingMemoryManager::ReleaseThreadCache(ThreadCache* thread_cache) {
+    for (int64_t size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+        std::vector<void*>& free_list = thread_cache->free_lists_[size_class];
+        bytes_cached_ -= GetSizeClassByteSize(size_class) * free_list.size();
+        for (void* ptr : free_list) {
+            FreeBlock(ptr);
+        }
+        free_list.clear();
+        free_list.shrink_to_fit();
+    }
+}
+
 }  // namespace open3d
@@ -26,6 +26,10 @@
 
 #pragma once
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace kernel {
 namespace parallel_util {
@@ -112,6 +112,27 @@ bool CanBeBrocastedToShape(const SizeVector& src_shape,
     }
 }
 
+SizeVector MatmulShape(const SizeVector& l_shape, const SizeVector& r_shape) {
+    int64_t l_ndims = l_shape.size();
+    int64_t r_ndims = r_shape.size();
+    if (l_ndims < 2 || r_ndims < 2) {
+        utility::LogError(
+                "Matmul expects tensors with at least 2 dims, but got {} and "
+                "{}.",
+                l_shape, r_shape);
+    }
+    if (l_shape[l_ndims - 1] != r_shape[r_ndims - 2]) {
+        utility::LogError("Matmul inner dims mismatch: {} and {}.", l_shape,
+                          r_shape);
+    }
+    SizeVector l_batch(l_shape.begin(), l_shape.end() - 2);
+    SizeVector r_batch(r_shape.begin(), r_shape.end() - 2);
+    SizeVector out_shape = BroadcastedShape(l_batch, r_batch);
+    out_shape.push_back(l_shape[l_ndims - 2]);
+    out_shape.push_back(r_shape[r_ndims - 1]);
+    return out_shape;
+}
+
 SizeVector ReductionShape(const SizeVector& src_shape,
                           const SizeVector& dims,
                           bool keepdim) {
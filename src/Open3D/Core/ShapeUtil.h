@@ -77,6 +77,16 @@ SizeVector ReductionShape(const SizeVector& src_shape,
                           const SizeVector& dims,
                           bool keepdim);
 
+/// \brief Returns the shape of a batched matrix multiplication.
+///
+/// The last two dims are the matrix dims and the leading dims are broadcasted.
+/// E.g. MatmulShape({4, 2, 3}, {3, 5}) -> {4, 2, 5}
+///      MatmulShape({4, 2, 3}, {2, 5}) -> Exception
+/// \param l_shape Shape of the left-hand-side Tensor, (..., M, K).
+/// \param r_shape Shape of the right-hand-side Tensor, (..., K, N).
+/// \return The output shape (..., M, N).
+SizeVector MatmulShape(const SizeVector& l_shape, const SizeVector& r_shape);
+
 /// \brief Wrap around negative \p dim.
 ///
 /// E.g. If max_dim == 5, dim -1 will be converted to 4.
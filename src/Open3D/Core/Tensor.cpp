@@ -239,6 +239,18 @@ Tensor Tensor::SetItem(const std::vector<TensorKey>& tks, const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::FromBufferView(void* data_ptr,
+                              const SizeVector& shape,
+                              Dtype dtype,
+                              const Device& device,
+                              const std::shared_ptr<void>& keepalive) {
+    if (data_ptr == nullptr && shape.NumElements() != 0) {
+        utility::LogError("Cannot create a Tensor view of a null pointer.");
+    }
+    auto blob = std::make_shared<Blob>(device, data_ptr, keepalive);
+    return Tensor(shape, DefaultStrides(shape), data_ptr, dtype, blob);
+}
+
 /// Assign (copy) values from another Tensor, shape, dtype, device may change.
 void Tensor::Assign(const Tensor& other) {
     shape_ = other.shape_;
@@ -545,7 +557,39 @@ Tensor Tensor::Slice(int64_t dim,
     return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
 }
 
+/// Returns true if \p index_tensors selects rows of \p tensor with a single
+/// 1-D Int64 index on dim 0. These are served by memcpy-based row kernels.
+static bool IsRowIndexing(const Tensor& tensor,
+                          const std::vector<Tensor>& index_tensors) {
+    return index_tensors.size() == 1 && tensor.NumDims() >= 1 &&
+           tensor.IsContiguous() &&
+           tensor.GetDevice().GetType() == Device::DeviceType::CPU &&
+           index_tensors[0].NumDims() == 1 &&
+           index_tensors[0].GetDtype() == Dtype::Int64 &&
+           index_tensors[0].GetDevice() == tensor.GetDevice();
+}
+
+/// Returns true if any of \p index_tensors is a boolean mask.
+static bool HasBoolIndex(const std::vector<Tensor>& index_tensors) {
+    return std::any_of(index_tensors.begin(), index_tensors.end(),
+                       [](const Tensor& index_tensor) {
+                           return index_tensor.GetDtype() == Dtype::Bool;
+                       });
+}
+
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    if (HasBoolIndex(index_tensors)) {
+        return IndexGet(AdvancedIndexPreprocessor::ExpandBoolTensors(
+                *this, index_tensors));
+    }
+    if (IsRowIndexing(*this, index_tensors)) {
+        SizeVector dst_shape = shape_;
+        dst_shape[0] = index_tensors[0].NumElements();
+        Tensor dst(dst_shape, dtype_, GetDevice());
+        kernel::IndexGetRows(*this, index_tensors[0], dst);
+        return dst;
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -556,12 +600,80 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
 
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
+    if (HasBoolIndex(index_tensors)) {
+        IndexSet(AdvancedIndexPreprocessor::ExpandBoolTensors(*this,
+                                                              index_tensors),
+                 src_tensor);
+        return;
+    }
+    if (IsRowIndexing(*this, index_tensors) && src_tensor.IsContiguous() &&
+        src_tensor.GetDtype() == dtype_ &&
+        src_tensor.GetDevice() == GetDevice()) {
+        SizeVector src_shape = shape_;
+        src_shape[0] = index_tensors[0].NumElements();
+        if (src_tensor.GetShape() == src_shape) {
+            kernel::IndexSetRows(src_tensor, index_tensors[0], *this);
+            return;
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor pre_processed_dst = aip.GetTensor();
     kernel::IndexSet(src_tensor, pre_processed_dst, aip.GetIndexTensors(),
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
+
+std::vector<Tensor> Tensor::NonZeroNumpy() const {
+    Tensor non_zero = NonZero();
+    std::vector<Tensor> indices;
+    for (int64_t dim = 0; dim < NumDims(); ++dim) {
+        indices.push_back(non_zero[dim]);
+    }
+    return indices;
+}
+
+Tensor Tensor::IndexAdd_(int64_t dim,
+                         const Tensor& index,
+                         const Tensor& src_tensor) {
+    if (NumDims() == 0) {
+        utility::LogError("IndexAdd_ does not support 0-dim tensors.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    if (index.NumDims() != 1) {
+        utility::LogError("IndexAdd_: index must be 1-D, but got shape {}.",
+                          index.GetShape().ToString());
+    }
+    SizeVector src_shape = shape_;
+    src_shape[dim] = index.NumElements();
+    if (src_tensor.GetShape() != src_shape) {
+        utility::LogError("IndexAdd_: expected src shape {}, but got {}.",
+                          src_shape.ToString(),
+                          src_tensor.GetShape().ToString());
+    }
+    if (src_tensor.GetDtype() != dtype_) {
+        utility::LogError("IndexAdd_: src dtype {} does not match {}.",
+                          DtypeUtil::ToString(src_tensor.GetDtype()),
+                          DtypeUtil::ToString(dtype_));
+    }
+
+    Tensor src_contiguous = src_tensor.GetDevice() == GetDevice()
+                                    ? src_tensor.Contiguous()
+                                    : src_tensor.Copy(GetDevice());
+    Tensor index_same_device = index.GetDevice() == GetDevice()
+                                       ? index
+                                       : index.Copy(GetDevice());
+    if (IsContiguous()) {
+        kernel::IndexAdd(src_contiguous, index_same_device, dim, *this);
+    } else {
+        Tensor dst = Contiguous();
+        kernel::IndexAdd(src_contiguous, index_same_device, dim, dst);
+        AsRvalue() = dst;
+    }
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -716,6 +828,37 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::Matmul(const Tensor& rhs) const {
+    Tensor dst(shape_util::MatmulShape(shape_, rhs.shape_), dtype_,
+               GetDevice());
+    kernel::Matmul(*this, rhs, dst);
+    return dst;
+}
+
+Tensor Tensor::Inverse() const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::Inverse(*this, dst);
+    return dst;
+}
+
+Tensor Tensor::Solve(const Tensor& rhs) const {
+    Tensor dst(rhs.shape_, dtype_, GetDevice());
+    kernel::Solve(*this, rhs, dst);
+    return dst;
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::SVD() const {
+    if (NumDims() < 2) {
+        utility::LogError("SVD expects a tensor of shape (..., 3, 3).");
+    }
+    Tensor u(shape_, dtype_, GetDevice());
+    Tensor s(SizeVector(shape_.begin(), shape_.end() - 1), dtype_,
+             GetDevice());
+    Tensor v(shape_, dtype_, GetDevice());
+    kernel::SVD3x3(*this, u, s, v);
+    return std::make_tuple(u, s, v);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -29,6 +29,10 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <vector>
+
+#include <Eigen/Core>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/DLPack/DLPackConverter.h"
@@ -259,6 +263,53 @@ public:
         return dlpack::FromDLPack(src);
     }
 
+    /// Create a contiguous Tensor viewing existing memory without copying.
+    /// The memory is not freed by the Tensor and must stay valid while the
+    /// Tensor or any Tensor sharing its Blob is alive. Pass the owner of the
+    /// memory as \p keepalive to tie its lifetime to the Tensor.
+    ///
+    /// E.g. to view a geometry::Image with float channels:
+    /// ```cpp
+    /// Tensor t = Tensor::FromBufferView(
+    ///         image.data_.data(),
+    ///         {image.height_, image.width_, image.num_of_channels_},
+    ///         Dtype::Float32);
+    /// ```
+    static Tensor FromBufferView(
+            void* data_ptr,
+            const SizeVector& shape,
+            Dtype dtype,
+            const Device& device = Device("CPU:0"),
+            const std::shared_ptr<void>& keepalive = nullptr);
+
+    /// Create an (N, Rows) CPU Tensor viewing a vector of fixed-size Eigen
+    /// vectors without copying, e.g. an (N, 3) Float64 Tensor over
+    /// geometry::PointCloud::points_ or an (N, 3) Int32 Tensor over
+    /// geometry::TriangleMesh::triangles_. Writes to the Tensor modify the
+    /// vectors in place.
+    ///
+    /// The view is invalidated when \p vectors reallocates, e.g. on
+    /// push_back() or resize(). Pass the owner of \p vectors as \p keepalive
+    /// to tie its lifetime to the Tensor.
+    template <typename Scalar,
+              int Rows,
+              int Options,
+              int MaxRows,
+              typename Allocator>
+    static Tensor FromEigenVectorView(
+            std::vector<Eigen::Matrix<Scalar, Rows, 1, Options, MaxRows, 1>,
+                        Allocator>& vectors,
+            const std::shared_ptr<void>& keepalive = nullptr) {
+        static_assert(Rows > 0, "Only fixed-size Eigen vectors are supported");
+        static_assert(sizeof(Eigen::Matrix<Scalar, Rows, 1, Options, MaxRows,
+                                           1>) == sizeof(Scalar) * Rows,
+                      "Eigen vector must be tightly packed");
+        return FromBufferView(vectors.data(),
+                              {static_cast<int64_t>(vectors.size()), Rows},
+                              DtypeUtil::FromType<Scalar>(), Device("CPU:0"),
+                              keepalive);
+    }
+
     /// Assign (copy) values from another Tensor, shape, dtype, device may
     /// change. Slices of the original Tensor still keeps the original memory.
     /// After assignment, the Tensor will be contiguous.
@@ -363,6 +414,28 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// \brief Find the indices of the non-zero elements.
+    ///
+    /// \return An Int64 Tensor of shape {NumDims(), num_non_zeros}. Column i
+    /// holds the coordinates of the i-th non-zero element in row-major order.
+    Tensor NonZero() const;
+
+    /// \brief Find the indices of the non-zero elements, as numpy.nonzero.
+    ///
+    /// \return NumDims() 1-D Int64 Tensors, one per dimension, that can be
+    /// used directly as index tensors for IndexGet and IndexSet.
+    std::vector<Tensor> NonZeroNumpy() const;
+
+    /// \brief Accumulates slices of \p src_tensor into this Tensor along
+    /// \p dim, in-place.
+    ///
+    /// For a 1-D Int64 \p index, computes
+    /// this[..., index[i], ...] += src_tensor[..., i, ...], where \p dim is the
+    /// indexed dimension. Duplicated indices accumulate.
+    Tensor IndexAdd_(int64_t dim,
+                     const Tensor& index,
+                     const Tensor& src_tensor);
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -538,6 +611,25 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Batched matrix multiplication. The last two dims of this tensor
+    /// (..., M, K) and \p rhs (..., K, N) are multiplied as matrices and the
+    /// leading batch dims are broadcasted, e.g. (B, M, K) @ (K, N) gives
+    /// (B, M, N).
+    Tensor Matmul(const Tensor& rhs) const;
+
+    /// Returns the inverse of each square matrix in the last two dims. Only
+    /// Float32 and Float64 are supported.
+    Tensor Inverse() const;
+
+    /// Solves A X = B, where A (..., N, N) is this tensor and B is \p rhs of
+    /// shape (..., N, K) or (..., N). Returns X with the shape of \p rhs.
+    Tensor Solve(const Tensor& rhs) const;
+
+    /// Singular value decomposition A = U diag(S) V^T of each 3x3 matrix in a
+    /// tensor of shape (..., 3, 3). Returns {U, S, V}, where S has shape
+    /// (..., 3) and is sorted in decreasing order.
+    std::tuple<Tensor, Tensor, Tensor> SVD() const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -0,0 +1,258 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/TensorExpr.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+using kernel::BinaryEWOpCode;
+using kernel::FusedEWInstruction;
+using kernel::UnaryEWOpCode;
+
+struct TensorExpr::Node {
+    /// Appends the instructions computing this node to \p program, reusing
+    /// registers of nodes that are already compiled, and returns the register
+    /// holding this node.
+    int64_t Compile(std::unordered_map<const Node*, int64_t>& node_registers,
+                    std::vector<Tensor>& inputs,
+                    std::vector<int64_t>& input_registers,
+                    std::vector<FusedEWInstruction>& program) const {
+        auto it = node_registers.find(this);
+        if (it != node_registers.end()) {
+            return it->second;
+        }
+
+        int64_t reg;
+        if (type_ == FusedEWInstruction::Type::Input) {
+            // The same tensor may be wrapped by several nodes, read it once.
+            int64_t input_idx = 0;
+            while (input_idx < static_cast<int64_t>(inputs.size()) &&
+                   !IsSameView(inputs[input_idx], tensor_)) {
+                input_idx++;
+            }
+            if (input_idx == static_cast<int64_t>(inputs.size())) {
+                inputs.push_back(tensor_);
+                input_registers.push_back(program.size());
+                program.push_back(
+                        FusedEWInstruction::MakeInput(input_idx, dtype_));
+            }
+            reg = input_registers[input_idx];
+        } else if (type_ == FusedEWInstruction::Type::Unary) {
+            int64_t src = lhs_->Compile(node_registers, inputs,
+                                        input_registers, program);
+            reg = program.size();
+            program.push_back(
+                    FusedEWInstruction::MakeUnary(unary_op_code_, src, dtype_));
+        } else {
+            int64_t lhs = lhs_->Compile(node_registers, inputs,
+                                        input_registers, program);
+            int64_t rhs = rhs_->Compile(node_registers, inputs,
+                                        input_registers, program);
+            reg = program.size();
+            program.push_back(FusedEWInstruction::MakeBinary(
+                    binary_op_code_, lhs, rhs, dtype_));
+        }
+        node_registers[this] = reg;
+        return reg;
+    }
+
+    static bool IsSameView(const Tensor& lhs, const Tensor& rhs) {
+        return lhs.GetDataPtr() == rhs.GetDataPtr() &&
+               lhs.GetShape() == rhs.GetShape() &&
+               lhs.GetStrides() == rhs.GetStrides() &&
+               lhs.GetDtype() == rhs.GetDtype() &&
+               lhs.GetDevice() == rhs.GetDevice();
+    }
+
+    FusedEWInstruction::Type type_ = FusedEWInstruction::Type::Input;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    /// Only used by input nodes.
+    Tensor tensor_;
+    /// Operands of unary (lhs_ only) and binary nodes.
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+    SizeVector shape_;
+    Dtype dtype_ = Dtype::Float32;
+    Device device_;
+};
+
+TensorExpr::TensorExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstruction::Type::Input;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    node_ = node;
+}
+
+Tensor TensorExpr::Eval() const {
+    std::unordered_map<const Node*, int64_t> node_registers;
+    std::vector<Tensor> inputs;
+    std::vector<int64_t> input_registers;
+    std::vector<FusedEWInstruction> program;
+    node_->Compile(node_registers, inputs, input_registers, program);
+
+    Tensor dst(node_->shape_, node_->dtype_, node_->device_);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+SizeVector TensorExpr::GetShape() const { return node_->shape_; }
+
+Dtype TensorExpr::GetDtype() const { return node_->dtype_; }
+
+Device TensorExpr::GetDevice() const { return node_->device_; }
+
+TensorExpr TensorExpr::Unary(UnaryEWOpCode op_code) const {
+    Dtype dtype = GetDtype();
+    if (op_code == UnaryEWOpCode::Sqrt || op_code == UnaryEWOpCode::Sin ||
+        op_code == UnaryEWOpCode::Cos || op_code == UnaryEWOpCode::Exp) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
+            utility::LogError(
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
+                    DtypeUtil::ToString(dtype));
+        }
+    } else if (op_code != UnaryEWOpCode::LogicalNot && dtype == Dtype::Bool) {
+        utility::LogError("Unsupported data type.");
+    }
+
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstruction::Type::Unary;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->shape_ = GetShape();
+    node->dtype_ = op_code == UnaryEWOpCode::LogicalNot ? Dtype::Bool : dtype;
+    node->device_ = GetDevice();
+    return TensorExpr(node);
+}
+
+TensorExpr TensorExpr::Binary(const TensorExpr& value,
+                              BinaryEWOpCode op_code) const {
+    if (GetDevice() != value.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.", GetDevice().ToString(),
+                          value.GetDevice().ToString());
+    }
+    if (GetDtype() != value.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(GetDtype()),
+                          DtypeUtil::ToString(value.GetDtype()));
+    }
+    bool is_boolean_op = kernel::s_boolean_binary_ew_op_codes.count(op_code);
+    if (!is_boolean_op && GetDtype() == Dtype::Bool) {
+        utility::LogError("Unsupported data type.");
+    }
+
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstruction::Type::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    node->shape_ = shape_util::BroadcastedShape(GetShape(), value.GetShape());
+    node->dtype_ = is_boolean_op ? Dtype::Bool : GetDtype();
+    node->device_ = GetDevice();
+    return TensorExpr(node);
+}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Add);
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Sub);
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Mul);
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Div);
+}
+
+TensorExpr TensorExpr::Sqrt() const { return Unary(UnaryEWOpCode::Sqrt); }
+
+TensorExpr TensorExpr::Sin() const { return Unary(UnaryEWOpCode::Sin); }
+
+TensorExpr TensorExpr::Cos() const { return Unary(UnaryEWOpCode::Cos); }
+
+TensorExpr TensorExpr::Neg() const { return Unary(UnaryEWOpCode::Neg); }
+
+TensorExpr TensorExpr::Exp() const { return Unary(UnaryEWOpCode::Exp); }
+
+TensorExpr TensorExpr::Abs() const { return Unary(UnaryEWOpCode::Abs); }
+
+TensorExpr TensorExpr::LogicalNot() const {
+    return Unary(UnaryEWOpCode::LogicalNot);
+}
+
+TensorExpr TensorExpr::LogicalAnd(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::LogicalAnd);
+}
+
+TensorExpr TensorExpr::LogicalOr(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::LogicalOr);
+}
+
+TensorExpr TensorExpr::LogicalXor(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::LogicalXor);
+}
+
+TensorExpr TensorExpr::Gt(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Gt);
+}
+
+TensorExpr TensorExpr::Lt(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Lt);
+}
+
+TensorExpr TensorExpr::Ge(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Ge);
+}
+
+TensorExpr TensorExpr::Le(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Le);
+}
+
+TensorExpr TensorExpr::Eq(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Eq);
+}
+
+TensorExpr TensorExpr::Ne(const TensorExpr& value) const {
+    return Binary(value, BinaryEWOpCode::Ne);
+}
+
+}  // namespace open3d
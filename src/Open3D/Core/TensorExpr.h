@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// TensorExpr is a lazily evaluated element-wise Tensor expression.
+///
+/// Element-wise ops on a TensorExpr do not compute anything, they record a
+/// DAG of ops instead. Eval() compiles the DAG into a single fused kernel that
+/// reads each input once and writes only the result, without allocating a
+/// Tensor per intermediate result. Shapes, dtypes and devices are checked when
+/// the expression is built, with the same rules as the Tensor ops.
+///
+/// Example:
+///     Tensor dst = ((TensorExpr(a) - b) * c + d).Eval();
+///
+/// The left-most tensor operand must be a TensorExpr, other Tensor operands
+/// are converted implicitly.
+class TensorExpr {
+public:
+    /// Restricts the scalar overloads to arithmetic types, such that Tensor
+    /// operands bind to the TensorExpr overloads.
+    template <typename T>
+    using ScalarOnly =
+            typename std::enable_if<std::is_arithmetic<T>::value>::type;
+
+    /// Creates an expression reading \p tensor. The tensor is read when the
+    /// expression is evaluated.
+    TensorExpr(const Tensor& tensor);
+
+    /// Evaluates the expression into a new contiguous Tensor.
+    Tensor Eval() const;
+
+    SizeVector GetShape() const;
+    Dtype GetDtype() const;
+    Device GetDevice() const;
+
+    TensorExpr Add(const TensorExpr& value) const;
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr Add(T scalar_value) const {
+        return Add(MakeScalar(scalar_value));
+    }
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator+(const Tensor& value) const { return Add(value); }
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr operator+(T scalar_value) const {
+        return Add(MakeScalar(scalar_value));
+    }
+
+    TensorExpr Sub(const TensorExpr& value) const;
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr Sub(T scalar_value) const {
+        return Sub(MakeScalar(scalar_value));
+    }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator-(const Tensor& value) const { return Sub(value); }
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr operator-(T scalar_value) const {
+        return Sub(MakeScalar(scalar_value));
+    }
+
+    TensorExpr Mul(const TensorExpr& value) const;
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr Mul(T scalar_value) const {
+        return Mul(MakeScalar(scalar_value));
+    }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator*(const Tensor& value) const { return Mul(value); }
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr operator*(T scalar_value) const {
+        return Mul(MakeScalar(scalar_value));
+    }
+
+    TensorExpr Div(const TensorExpr& value) const;
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr Div(T scalar_value) const {
+        return Div(MakeScalar(scalar_value));
+    }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator/(const Tensor& value) const { return Div(value); }
+    template <typename T, typename = ScalarOnly<T>>
+    TensorExpr operator/(T scalar_value) const {
+        return Div(MakeScalar(scalar_value));
+    }
+
+    TensorExpr Sqrt() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+    TensorExpr Neg() const;
+    TensorExpr operator-() const { return Neg(); }
+    TensorExpr Exp() const;
+    TensorExpr Abs() const;
+
+    /// Logical and comparison ops output boolean expressions.
+    TensorExpr LogicalNot() const;
+    TensorExpr LogicalAnd(const TensorExpr& value) const;
+    TensorExpr LogicalOr(const TensorExpr& value) const;
+    TensorExpr LogicalXor(const TensorExpr& value) const;
+    TensorExpr Gt(const TensorExpr& value) const;
+    TensorExpr operator>(const TensorExpr& value) const { return Gt(value); }
+    TensorExpr Lt(const TensorExpr& value) const;
+    TensorExpr operator<(const TensorExpr& value) const { return Lt(value); }
+    TensorExpr Ge(const TensorExpr& value) const;
+    TensorExpr operator>=(const TensorExpr& value) const { return Ge(value); }
+    TensorExpr Le(const TensorExpr& value) const;
+    TensorExpr operator<=(const TensorExpr& value) const { return Le(value); }
+    TensorExpr Eq(const TensorExpr& value) const;
+    TensorExpr operator==(const TensorExpr& value) const { return Eq(value); }
+    TensorExpr Ne(const TensorExpr& value) const;
+    TensorExpr operator!=(const TensorExpr& value) const { return Ne(value); }
+
+protected:
+    struct Node;
+
+    TensorExpr(const std::shared_ptr<const Node>& node) : node_(node) {}
+
+    TensorExpr Unary(kernel::UnaryEWOpCode op_code) const;
+    TensorExpr Binary(const TensorExpr& value,
+                      kernel::BinaryEWOpCode op_code) const;
+
+    template <typename T>
+    TensorExpr MakeScalar(T scalar_value) const {
+        return TensorExpr(
+                Tensor::Full({}, scalar_value, GetDtype(), GetDevice()));
+    }
+
+    std::shared_ptr<const Node> node_;
+};
+
+template <typename T, typename = TensorExpr::ScalarOnly<T>>
+inline TensorExpr operator+(T scalar_lhs, const TensorExpr& rhs) {
+    return rhs + scalar_lhs;
+}
+
+template <typename T, typename = TensorExpr::ScalarOnly<T>>
+inline TensorExpr operator-(T scalar_lhs, const TensorExpr& rhs) {
+    return TensorExpr(Tensor::Full({}, scalar_lhs, rhs.GetDtype(),
+                                   rhs.GetDevice())) -
+           rhs;
+}
+
+template <typename T, typename = TensorExpr::ScalarOnly<T>>
+inline TensorExpr operator*(T scalar_lhs, const TensorExpr& rhs) {
+    return rhs * scalar_lhs;
+}
+
+template <typename T, typename = TensorExpr::ScalarOnly<T>>
+inline TensorExpr operator/(T scalar_lhs, const TensorExpr& rhs) {
+    return TensorExpr(Tensor::Full({}, scalar_lhs, rhs.GetDtype(),
+                                   rhs.GetDevice())) /
+           rhs;
+}
+
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #include <Eigen/Eigenvalues>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 
@@ -218,15 +219,16 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
 }
 
 Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
-                              const std::vector<int> &indices,
+                              const int *indices,
+                              size_t num_indices,
                               bool fast_normal_computation) {
-    if (indices.size() == 0) {
+    if (num_indices == 0) {
         return Eigen::Vector3d::Zero();
     }
     Eigen::Matrix3d covariance;
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
-    for (size_t i = 0; i < indices.size(); i++) {
+    for (size_t i = 0; i < num_indices; i++) {
         const Eigen::Vector3d &point = cloud.points_[indices[i]];
         cumulants(0) += point(0);
         cumulants(1) += point(1);
@@ -238,7 +240,7 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
         cumulants(7) += point(1) * point(2);
         cumulants(8) += point(2) * point(2);
     }
-    cumulants /= (double)indices.size();
+    cumulants /= (double)num_indices;
     covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
     covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
     covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
@@ -258,6 +260,33 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
+/// Estimates the normal of point i from its neighborhood, keeping the
+/// orientation of the previous normal if the point cloud had normals.
+void EstimateNormal(PointCloud &cloud,
+                    size_t i,
+                    const int *indices,
+                    size_t num_indices,
+                    bool has_normal,
+                    bool fast_normal_computation) {
+    if (num_indices < 3) {
+        cloud.normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+        return;
+    }
+    Eigen::Vector3d normal = ComputeNormal(cloud, indices, num_indices,
+                                           fast_normal_computation);
+    if (normal.norm() == 0.0) {
+        if (has_normal) {
+            normal = cloud.normals_[i];
+        } else {
+            normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+        }
+    }
+    if (has_normal && normal.dot(cloud.normals_[i]) < 0.0) {
+        normal *= -1.0;
+    }
+    cloud.normals_[i] = normal;
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -265,35 +294,53 @@ namespace geometry {
 bool PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(*this);
+    return EstimateNormals(search_param, fast_normal_computation, kdtree);
+}
+
+bool PointCloud::EstimateNormals(const KDTreeSearchParam &search_param,
+                                 bool fast_normal_computation,
+                                 const KDTreeFlann &kdtree) {
+    if (kdtree.GetDataSize() != points_.size()) {
+        utility::LogError(
+                "[EstimateNormals] kdtree is not built on this point cloud.");
+    }
     bool has_normal = HasNormals();
     if (HasNormals() == false) {
         normals_.resize(points_.size());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)points_.size(); i++) {
         std::vector<int> indices;
         std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-                }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-        }
+        kdtree.Search(points_[i], search_param, indices, distance2);
+        EstimateNormal(*this, i, indices.data(), indices.size(), has_normal,
+                       fast_normal_computation);
+    }
+
+    return true;
+}
+
+bool PointCloud::EstimateNormals(const NeighborGraph &graph,
+                                 bool fast_normal_computation /* = true */) {
+    if (graph.GetNodeCount() != points_.size()) {
+        utility::LogError(
+                "[EstimateNormals] graph is not built on this point cloud.");
+    }
+    bool has_normal = HasNormals();
+    if (HasNormals() == false) {
+        normals_.resize(points_.size());
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)points_.size(); i++) {
+        EstimateNormal(*this, i, graph.indices_.data() + graph.offsets_[i],
+                       graph.GetNeighborCount(i), has_normal,
+                       fast_normal_computation);
     }
 
     return true;
@@ -0,0 +1,501 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/KDTreeDynamic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of queries handled by one task in the batched search.
+static constexpr int64_t SEARCH_BATCH_BLOCK_SIZE = 256;
+
+}  // unnamed namespace
+
+template <int Dim>
+KDTreeDynamic<Dim>::KDTreeDynamic(int leaf_size /* = 16 */)
+    : leaf_size_(std::max(leaf_size, 1)) {}
+
+template <int Dim>
+KDTreeDynamic<Dim>::~KDTreeDynamic() {}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::AddPoints(const Eigen::MatrixXd &points) {
+    return AddRawPoints(Eigen::Map<const Eigen::MatrixXd>(
+            points.data(), points.rows(), points.cols()));
+}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::AddPoints(const std::vector<Eigen::Vector3d> &points) {
+    return AddRawPoints(Eigen::Map<const Eigen::MatrixXd>(
+            (const double *)points.data(), 3, points.size()));
+}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::AddRawPoints(
+        const Eigen::Map<const Eigen::MatrixXd> &points) {
+    if (points.rows() != Dim) {
+        utility::LogWarning(
+                "[KDTreeDynamic::AddPoints] Point dimension {} does not match "
+                "the tree dimension {}.",
+                points.rows(), Dim);
+        return false;
+    }
+    if (point_tree_.size() + points.cols() >
+        size_t(std::numeric_limits<int>::max())) {
+        utility::LogWarning(
+                "[KDTreeDynamic::AddPoints] Too many points for int ids.");
+        return false;
+    }
+    if (points.cols() == 0) {
+        return true;
+    }
+    const int first_id = int(point_tree_.size());
+    const int num_new = int(points.cols());
+    point_tree_.resize(first_id + num_new, -1);
+    point_position_.resize(first_id + num_new, -1);
+
+    std::vector<int> ids(num_new);
+    std::iota(ids.begin(), ids.end(), first_id);
+    trees_.push_back(BuildTree(ids, points));
+    num_points_ += num_new;
+    Rebalance();
+    return true;
+}
+
+template <int Dim>
+int KDTreeDynamic<Dim>::RemovePoints(const std::vector<int> &ids) {
+    int num_removed = 0;
+    for (int id : ids) {
+        if (!HasPoint(id)) {
+            continue;
+        }
+        const int uid = point_tree_[id];
+        for (auto &tree : trees_) {
+            if (tree->uid_ == uid) {
+                tree->kdtree_->RemovePoint(
+                        tree->kdtree_->GetStoredIndex(point_position_[id]));
+                tree->num_removed_++;
+                break;
+            }
+        }
+        point_tree_[id] = -1;
+        num_removed++;
+    }
+    if (num_removed == 0) {
+        return 0;
+    }
+    num_points_ -= num_removed;
+
+    // Compact the trees that lost half of their points.
+    bool rebuilt = false;
+    for (auto &tree : trees_) {
+        if (2 * tree->num_removed_ > tree->ids_.size()) {
+            tree = RebuildTree(*tree);
+            rebuilt = true;
+        }
+    }
+    if (rebuilt) {
+        trees_.erase(std::remove_if(trees_.begin(), trees_.end(),
+                                    [](const std::unique_ptr<Tree> &tree) {
+                                        return tree->ids_.empty();
+                                    }),
+                     trees_.end());
+        Rebalance();
+    }
+    return num_removed;
+}
+
+template <int Dim>
+void KDTreeDynamic<Dim>::Clear() {
+    trees_.clear();
+    point_tree_.clear();
+    point_position_.clear();
+    num_points_ = 0;
+}
+
+template <int Dim>
+std::vector<int> KDTreeDynamic<Dim>::Compact() {
+    std::vector<int> new_ids(point_tree_.size(), -1);
+    int num_ids = 0;
+    for (size_t id = 0; id < point_tree_.size(); id++) {
+        if (point_tree_[id] >= 0) {
+            point_tree_[num_ids] = point_tree_[id];
+            point_position_[num_ids] = point_position_[id];
+            new_ids[id] = num_ids++;
+        }
+    }
+    point_tree_.resize(num_ids);
+    point_tree_.shrink_to_fit();
+    point_position_.resize(num_ids);
+    point_position_.shrink_to_fit();
+    // The removed points stay in their trees until the next rebuild, with
+    // id -1.
+    for (auto &tree : trees_) {
+        for (int &id : tree->ids_) {
+            id = id >= 0 ? new_ids[id] : -1;
+        }
+    }
+    return new_ids;
+}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::HasPoint(int id) const {
+    return id >= 0 && size_t(id) < point_tree_.size() && point_tree_[id] >= 0;
+}
+
+template <int Dim>
+typename KDTreeDynamic<Dim>::QueryType KDTreeDynamic<Dim>::GetPoint(
+        int id) const {
+    if (!HasPoint(id)) {
+        utility::LogError("[KDTreeDynamic::GetPoint] Invalid id {}.", id);
+    }
+    QueryType point = QueryType::Zero();
+    for (const auto &tree : trees_) {
+        if (tree->uid_ == point_tree_[id]) {
+            point = tree->kdtree_->GetStoredPoint(point_position_[id]);
+            break;
+        }
+    }
+    return point;
+}
+
+template <int Dim>
+std::unique_ptr<typename KDTreeDynamic<Dim>::Tree>
+KDTreeDynamic<Dim>::BuildTree(const std::vector<int> &ids,
+                              const Eigen::MatrixXd &data) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->uid_ = next_tree_uid_++;
+    tree->ids_ = ids;
+    tree->num_removed_ = 0;
+    tree->kdtree_.reset(new KDTreeFloat<Dim>(leaf_size_));
+    if (ids.empty()) {
+        return tree;
+    }
+    tree->kdtree_->SetMatrixData(data);
+    for (int position = 0; position < int(ids.size()); position++) {
+        const int id = ids[tree->kdtree_->GetStoredIndex(position)];
+        point_tree_[id] = tree->uid_;
+        point_position_[id] = position;
+    }
+    return tree;
+}
+
+template <int Dim>
+std::unique_ptr<typename KDTreeDynamic<Dim>::Tree>
+KDTreeDynamic<Dim>::RebuildTree(const Tree &tree) {
+    std::vector<int> ids;
+    ids.reserve(tree.GetAliveCount());
+    Eigen::MatrixXd data(Dim, tree.GetAliveCount());
+    GetAlivePoints(tree, ids, data);
+    return BuildTree(ids, data);
+}
+
+template <int Dim>
+void KDTreeDynamic<Dim>::GetAlivePoints(const Tree &tree,
+                                        std::vector<int> &ids,
+                                        Eigen::MatrixXd &data) const {
+    // Positions follow the leaf order, so the coordinates are read
+    // sequentially.
+    for (int position = 0; position < int(tree.ids_.size()); position++) {
+        const int id = tree.ids_[tree.kdtree_->GetStoredIndex(position)];
+        if (id >= 0 && point_tree_[id] == tree.uid_) {
+            data.col(ids.size()) = tree.kdtree_->GetStoredPoint(position);
+            ids.push_back(id);
+        }
+    }
+}
+
+template <int Dim>
+void KDTreeDynamic<Dim>::Rebalance() {
+    auto larger = [](const std::unique_ptr<Tree> &a,
+                     const std::unique_ptr<Tree> &b) {
+        return a->GetAliveCount() > b->GetAliveCount();
+    };
+    std::stable_sort(trees_.begin(), trees_.end(), larger);
+    size_t i = trees_.size();
+    while (i > 1) {
+        i--;
+        if (trees_[i - 1]->GetAliveCount() >= 2 * trees_[i]->GetAliveCount()) {
+            continue;
+        }
+        const size_t num_merged =
+                trees_[i - 1]->GetAliveCount() + trees_[i]->GetAliveCount();
+        std::vector<int> ids;
+        ids.reserve(num_merged);
+        Eigen::MatrixXd data(Dim, num_merged);
+        GetAlivePoints(*trees_[i - 1], ids, data);
+        GetAlivePoints(*trees_[i], ids, data);
+        trees_[i - 1] = BuildTree(ids, data);
+        trees_.erase(trees_.begin() + i);
+        std::stable_sort(trees_.begin(), trees_.end(), larger);
+        i = trees_.size();
+    }
+}
+
+template <int Dim>
+void KDTreeDynamic<Dim>::SearchNearest(const QueryType &query,
+                                       int k,
+                                       double max_dist2,
+                                       std::vector<int> &indices,
+                                       std::vector<double> &distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (k == 0) {
+        return;
+    }
+    std::vector<int> tree_indices, merged_indices;
+    std::vector<double> tree_dists, merged_dists;
+    for (const auto &tree : trees_) {
+        if (tree->GetAliveCount() == 0) {
+            continue;
+        }
+        // Once k neighbors are found, the next trees only need to be searched
+        // within the current k-th distance.
+        double bound = max_dist2;
+        if (indices.size() == size_t(k)) {
+            bound = std::min(bound, distance2.back());
+        }
+        if (std::isinf(bound)) {
+            tree->kdtree_->SearchKNN(query, k, tree_indices, tree_dists);
+        } else {
+            tree->kdtree_->SearchHybrid(query, std::sqrt(bound), k,
+                                        tree_indices, tree_dists);
+        }
+        if (tree_indices.empty()) {
+            continue;
+        }
+        merged_indices.clear();
+        merged_dists.clear();
+        size_t a = 0, b = 0;
+        while (merged_indices.size() < size_t(k) &&
+               (a < indices.size() || b < tree_indices.size())) {
+            if (b == tree_indices.size() ||
+                (a < indices.size() && distance2[a] <= tree_dists[b])) {
+                merged_indices.push_back(indices[a]);
+                merged_dists.push_back(distance2[a]);
+                a++;
+            } else {
+                merged_indices.push_back(tree->ids_[tree_indices[b]]);
+                merged_dists.push_back(tree_dists[b]);
+                b++;
+            }
+        }
+        indices.swap(merged_indices);
+        distance2.swap(merged_dists);
+    }
+}
+
+template <int Dim>
+int KDTreeDynamic<Dim>::Search(const QueryType &query,
+                               const KDTreeSearchParam &param,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2) const {
+    if (num_points_ == 0) {
+        return -1;
+    }
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn: {
+            int knn = ((const KDTreeSearchParamKNN &)param).knn_;
+            if (knn < 0) {
+                return -1;
+            }
+            SearchNearest(query, knn, std::numeric_limits<double>::infinity(),
+                          indices, distance2);
+            return int(indices.size());
+        }
+        case KDTreeSearchParam::SearchType::Radius: {
+            double radius = ((const KDTreeSearchParamRadius &)param).radius_;
+            if (radius <= 0.0) {
+                return -1;
+            }
+            std::vector<std::pair<double, int>> neighbors;
+            for (const auto &tree : trees_) {
+                if (tree->GetAliveCount() == 0) {
+                    continue;
+                }
+                tree->kdtree_->SearchRadius(query, radius, indices, distance2);
+                for (size_t i = 0; i < indices.size(); i++) {
+                    neighbors.emplace_back(distance2[i],
+                                           tree->ids_[indices[i]]);
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            indices.resize(neighbors.size());
+            distance2.resize(neighbors.size());
+            for (size_t i = 0; i < neighbors.size(); i++) {
+                distance2[i] = neighbors[i].first;
+                indices[i] = neighbors[i].second;
+            }
+            return int(indices.size());
+        }
+        case KDTreeSearchParam::SearchType::Hybrid: {
+            const auto &hybrid = (const KDTreeSearchParamHybrid &)param;
+            if (hybrid.max_nn_ < 0) {
+                return -1;
+            }
+            SearchNearest(query, hybrid.max_nn_,
+                          hybrid.radius_ * hybrid.radius_, indices, distance2);
+            return int(indices.size());
+        }
+        default:
+            return -1;
+    }
+}
+
+template <int Dim>
+int KDTreeDynamic<Dim>::SearchKNN(const QueryType &query,
+                                  int knn,
+                                  std::vector<int> &indices,
+                                  std::vector<double> &distance2) const {
+    return Search(query, KDTreeSearchParamKNN(knn), indices, distance2);
+}
+
+template <int Dim>
+int KDTreeDynamic<Dim>::SearchRadius(const QueryType &query,
+                                     double radius,
+                                     std::vector<int> &indices,
+                                     std::vector<double> &distance2) const {
+    return Search(query, KDTreeSearchParamRadius(radius), indices, distance2);
+}
+
+template <int Dim>
+int KDTreeDynamic<Dim>::SearchHybrid(const QueryType &query,
+                                     double radius,
+                                     int max_nn,
+                                     std::vector<int> &indices,
+                                     std::vector<double> &distance2) const {
+    return Search(query, KDTreeSearchParamHybrid(radius, max_nn), indices,
+                  distance2);
+}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::SearchBatch(const Eigen::MatrixXd &queries,
+                                     const KDTreeSearchParam &param,
+                                     std::vector<int> &indices,
+                                     std::vector<double> &distance2,
+                                     std::vector<size_t> &offsets) const {
+    return SearchBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            param, indices, distance2, offsets);
+}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::SearchBatch(
+        const std::vector<Eigen::Vector3d> &queries,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    return SearchBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            param, indices, distance2, offsets);
+}
+
+template <int Dim>
+bool KDTreeDynamic<Dim>::SearchBatchRaw(
+        const Eigen::Map<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    if (num_points_ == 0 || queries.rows() != Dim) {
+        return false;
+    }
+    if ((param.GetSearchType() == KDTreeSearchParam::SearchType::Knn &&
+         ((const KDTreeSearchParamKNN &)param).knn_ < 0) ||
+        (param.GetSearchType() == KDTreeSearchParam::SearchType::Radius &&
+         ((const KDTreeSearchParamRadius &)param).radius_ <= 0.0) ||
+        (param.GetSearchType() == KDTreeSearchParam::SearchType::Hybrid &&
+         ((const KDTreeSearchParamHybrid &)param).max_nn_ < 0)) {
+        return false;
+    }
+    const int64_t num_queries = queries.cols();
+    const int64_t num_blocks =
+            (num_queries + SEARCH_BATCH_BLOCK_SIZE - 1) /
+            SEARCH_BATCH_BLOCK_SIZE;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<double>> block_dists(num_blocks);
+    offsets.assign(num_queries + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> query_indices;
+        std::vector<double> query_dists;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t b = 0; b < num_blocks; b++) {
+            const int64_t begin = b * SEARCH_BATCH_BLOCK_SIZE;
+            const int64_t end =
+                    std::min(begin + SEARCH_BATCH_BLOCK_SIZE, num_queries);
+            for (int64_t i = begin; i < end; i++) {
+                Search(queries.col(i), param, query_indices, query_dists);
+                // Counts for now, turned into offsets below.
+                offsets[i + 1] = query_indices.size();
+                block_indices[b].insert(block_indices[b].end(),
+                                        query_indices.begin(),
+                                        query_indices.end());
+                block_dists[b].insert(block_dists[b].end(),
+                                      query_dists.begin(), query_dists.end());
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < num_queries; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets.back());
+    distance2.resize(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t b = 0; b < num_blocks; b++) {
+        const size_t start = offsets[b * SEARCH_BATCH_BLOCK_SIZE];
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  indices.begin() + start);
+        std::copy(block_dists[b].begin(), block_dists[b].end(),
+                  distance2.begin() + start);
+    }
+    return true;
+}
+
+template class KDTreeDynamic<2>;
+template class KDTreeDynamic<3>;
+
+}  // namespace geometry
+}  // namespace open3d
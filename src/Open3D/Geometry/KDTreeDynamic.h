@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeFloat.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class KDTreeDynamic
+///
+/// \brief KDTree supporting point insertion and removal without a full
+/// rebuild.
+///
+/// The points are spread over a forest of static KDTreeFloat trees whose
+/// sizes at least double from one tree to the next (logarithmic method).
+/// Added points form a new tree, which is merged with the smaller trees until
+/// the size invariant holds again, so every point takes part in O(log n)
+/// rebuilds. Removed points are skipped by the searches right away, and a
+/// tree is rebuilt once half of its points are removed. The coordinates are
+/// only stored in the trees.
+///
+/// The i-th point ever added gets id i. Ids are stable until Compact() is
+/// called, and all searches return ids. The tree keeps 8 bytes per id ever
+/// added, so long-running streams that remove most of their points should
+/// call Compact() from time to time.
+template <int Dim>
+class KDTreeDynamic {
+public:
+    typedef Eigen::Matrix<double, Dim, 1> QueryType;
+
+    /// \brief Default Constructor.
+    ///
+    /// \param leaf_size Maximum number of points in a leaf bucket.
+    KDTreeDynamic(int leaf_size = 16);
+    ~KDTreeDynamic();
+    KDTreeDynamic(const KDTreeDynamic &) = delete;
+    KDTreeDynamic &operator=(const KDTreeDynamic &) = delete;
+
+public:
+    /// Adds points given as the columns of a matrix with Dim rows.
+    bool AddPoints(const Eigen::MatrixXd &points);
+    /// Adds 3D points. Only valid for Dim == 3.
+    bool AddPoints(const std::vector<Eigen::Vector3d> &points);
+    /// Removes points by id, ignoring unknown or already removed ids.
+    /// Returns the number of points removed.
+    int RemovePoints(const std::vector<int> &ids);
+    /// Removes all points and resets the ids.
+    void Clear();
+    /// \brief Renumbers the points to the ids [0, GetDataSize()), in the
+    /// order of their current ids, and releases the slots of the removed ids.
+    ///
+    /// \return The new id of every current id, -1 for removed ids.
+    std::vector<int> Compact();
+
+    /// Returns true if the point with the given id is in the tree.
+    bool HasPoint(int id) const;
+    /// Returns the point with the given id, in single precision. The point
+    /// must not be removed.
+    QueryType GetPoint(int id) const;
+    /// Returns the number of points in the tree.
+    size_t GetDataSize() const { return num_points_; }
+    /// Returns the number of static trees in the forest.
+    size_t GetTreeCount() const { return trees_.size(); }
+
+    /// The searches follow the conventions of KDTreeFlann: they return the
+    /// number of neighbors found, sorted by increasing squared distance, or
+    /// -1 on invalid input.
+    int Search(const QueryType &query,
+               const KDTreeSearchParam &param,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) const;
+    int SearchKNN(const QueryType &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) const;
+    int SearchRadius(const QueryType &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+    int SearchHybrid(const QueryType &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// \brief Searches the neighbors of many queries in parallel.
+    ///
+    /// Same CSR output layout as KDTreeFlann::SearchBatch: the neighbors of
+    /// query i are indices[offsets[i]:offsets[i + 1]].
+    bool SearchBatch(const Eigen::MatrixXd &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<size_t> &offsets) const;
+    bool SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<size_t> &offsets) const;
+
+private:
+    /// A static tree of the forest with the ids of its points, -1 for the
+    /// removed points released by Compact().
+    struct Tree {
+        int uid_;
+        std::unique_ptr<KDTreeFloat<Dim>> kdtree_;
+        std::vector<int> ids_;
+        size_t num_removed_;
+        size_t GetAliveCount() const { return ids_.size() - num_removed_; }
+    };
+
+    bool AddRawPoints(const Eigen::Map<const Eigen::MatrixXd> &points);
+    bool SearchBatchRaw(const Eigen::Map<const Eigen::MatrixXd> &queries,
+                        const KDTreeSearchParam &param,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2,
+                        std::vector<size_t> &offsets) const;
+    /// Builds a tree over the given ids, whose points are the columns of
+    /// data, and updates their locations.
+    std::unique_ptr<Tree> BuildTree(const std::vector<int> &ids,
+                                    const Eigen::MatrixXd &data);
+    /// Rebuilds a tree without its removed points.
+    std::unique_ptr<Tree> RebuildTree(const Tree &tree);
+    /// Appends the ids of the points of a tree that are not removed to ids,
+    /// and their coordinates to the next columns of data.
+    void GetAlivePoints(const Tree &tree,
+                        std::vector<int> &ids,
+                        Eigen::MatrixXd &data) const;
+    /// Merges trees until each tree is at least twice as large as the next.
+    void Rebalance();
+    /// Searches up to k nearest points with squared distance below
+    /// max_dist2, in all trees.
+    void SearchNearest(const QueryType &query,
+                       int k,
+                       double max_dist2,
+                       std::vector<int> &indices,
+                       std::vector<double> &distance2) const;
+
+private:
+    int leaf_size_;
+    int next_tree_uid_ = 0;
+    size_t num_points_ = 0;
+    /// Trees sorted by decreasing size.
+    std::vector<std::unique_ptr<Tree>> trees_;
+    /// Tree uid and storage position in that tree of every id, uid -1 once
+    /// removed.
+    std::vector<int> point_tree_;
+    std::vector<int> point_position_;
+};
+
+typedef KDTreeDynamic<3> KDTreeDynamic3D;
+
+}  // namespace geometry
+}  // namespace open3d
@@ -31,7 +31,9 @@
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 
+#include <array>
 #include <flann/flann.hpp>
+#include <numeric>
 
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -43,11 +45,24 @@ namespace geometry {
 
 KDTreeFlann::KDTreeFlann() {}
 
-KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+KDTreeFlann::KDTreeFlann(const KDTreeIndexParam &index_param)
+    : index_param_(index_param) {}
 
-KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
+KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data,
+                         const KDTreeIndexParam &index_param)
+    : index_param_(index_param) {
+    SetMatrixData(data);
+}
+
+KDTreeFlann::KDTreeFlann(const Geometry &geometry,
+                         const KDTreeIndexParam &index_param)
+    : index_param_(index_param) {
+    SetGeometry(geometry);
+}
 
-KDTreeFlann::KDTreeFlann(const registration::Feature &feature) {
+KDTreeFlann::KDTreeFlann(const registration::Feature &feature,
+                         const KDTreeIndexParam &index_param)
+    : index_param_(index_param) {
     SetFeature(feature);
 }
 
@@ -125,8 +140,9 @@ int KDTreeFlann::SearchKNN(const T &query,
     distance2.resize(knn);
     flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
     flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
-    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
+    int k = flann_index_->knnSearch(
+            query_flann, indices_flann, dists_flann, knn,
+            flann::SearchParams(GetSearchChecks(), 0.0));
     indices.resize(k);
     distance2.resize(k);
     return k;
@@ -146,7 +162,7 @@ int KDTreeFlann::SearchRadius(const T &query,
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
+    flann::SearchParams param(GetSearchChecks(), 0.0);
     param.max_neighbors = -1;
     std::vector<std::vector<int>> indices_vec(1);
     std::vector<std::vector<double>> dists_vec(1);
@@ -172,7 +188,7 @@ int KDTreeFlann::SearchHybrid(const T &query,
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
+    flann::SearchParams param(GetSearchChecks(), 0.0);
     param.max_neighbors = max_nn;
     indices.resize(max_nn);
     distance2.resize(max_nn);
@@ -186,6 +202,361 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
+namespace {
+
+/// Number of queries handled by one FLANN call in the batched searches.
+static constexpr int64_t SEARCH_BATCH_BLOCK_SIZE = 256;
+
+/// Concatenates per-block search results into the CSR outputs. Each block
+/// holds the neighbors of consecutive queries, with their per-query counts.
+void MergeBlockResults(const std::vector<std::vector<int>> &block_indices,
+                       const std::vector<std::vector<double>> &block_dists,
+                       const std::vector<std::vector<size_t>> &block_counts,
+                       int64_t block_size,
+                       std::vector<int> &indices,
+                       std::vector<double> &distance2,
+                       std::vector<size_t> &offsets) {
+    const int64_t num_blocks = int64_t(block_counts.size());
+    std::vector<size_t> block_offsets(num_blocks + 1, 0);
+    for (int64_t b = 0; b < num_blocks; b++) {
+        block_offsets[b + 1] = block_offsets[b] + block_indices[b].size();
+    }
+    indices.resize(block_offsets[num_blocks]);
+    distance2.resize(block_offsets[num_blocks]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t b = 0; b < num_blocks; b++) {
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  indices.begin() + block_offsets[b]);
+        std::copy(block_dists[b].begin(), block_dists[b].end(),
+                  distance2.begin() + block_offsets[b]);
+        size_t offset = block_offsets[b];
+        for (size_t i = 0; i < block_counts[b].size(); i++) {
+            offsets[b * block_size + i] = offset;
+            offset += block_counts[b][i];
+        }
+    }
+    offsets.back() = block_offsets[num_blocks];
+}
+
+}  // unnamed namespace
+
+bool KDTreeFlann::SearchBatch(const Eigen::MatrixXd &queries,
+                              const KDTreeSearchParam &param,
+                              std::vector<int> &indices,
+                              std::vector<double> &distance2,
+                              std::vector<size_t> &offsets) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNNBatch(queries,
+                                  ((const KDTreeSearchParamKNN &)param).knn_,
+                                  indices, distance2, offsets);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadiusBatch(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2, offsets);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybridBatch(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2, offsets);
+        default:
+            return false;
+    }
+    return false;
+}
+
+bool KDTreeFlann::SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                              const KDTreeSearchParam &param,
+                              std::vector<int> &indices,
+                              std::vector<double> &distance2,
+                              std::vector<size_t> &offsets) const {
+    return SearchBatch(Eigen::Map<const Eigen::MatrixXd>(
+                               (const double *)queries.data(), 3,
+                               queries.size()),
+                       param, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchKNNBatch(const Eigen::MatrixXd &queries,
+                                 int knn,
+                                 std::vector<int> &indices,
+                                 std::vector<double> &distance2,
+                                 std::vector<size_t> &offsets) const {
+    return SearchKNNBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            knn, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchKNNBatch(const std::vector<Eigen::Vector3d> &queries,
+                                 int knn,
+                                 std::vector<int> &indices,
+                                 std::vector<double> &distance2,
+                                 std::vector<size_t> &offsets) const {
+    return SearchKNNBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            knn, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchRadiusBatch(const Eigen::MatrixXd &queries,
+                                    double radius,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &distance2,
+                                    std::vector<size_t> &offsets) const {
+    return SearchRadiusBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            radius, -1, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchRadiusBatch(const std::vector<Eigen::Vector3d> &queries,
+                                    double radius,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &distance2,
+                                    std::vector<size_t> &offsets) const {
+    return SearchRadiusBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            radius, -1, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchHybridBatch(const Eigen::MatrixXd &queries,
+                                    double radius,
+                                    int max_nn,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &distance2,
+                                    std::vector<size_t> &offsets) const {
+    if (max_nn < 0) {
+        return false;
+    }
+    return SearchRadiusBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            radius, max_nn, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchHybridBatch(const std::vector<Eigen::Vector3d> &queries,
+                                    double radius,
+                                    int max_nn,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &distance2,
+                                    std::vector<size_t> &offsets) const {
+    if (max_nn < 0) {
+        return false;
+    }
+    return SearchRadiusBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            radius, max_nn, indices, distance2, offsets);
+}
+
+bool KDTreeFlann::SearchKNNBatchRaw(
+        const Eigen::Map<const Eigen::MatrixXd> &queries,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        return false;
+    }
+    // Every query has exactly min(knn, dataset_size_) neighbors, so the
+    // results of each block are written in place.
+    const int64_t num_queries = queries.cols();
+    const int64_t k = std::min(int64_t(knn), int64_t(dataset_size_));
+    indices.resize(num_queries * k);
+    distance2.resize(num_queries * k);
+    offsets.resize(num_queries + 1);
+    for (int64_t i = 0; i <= num_queries; i++) {
+        offsets[i] = size_t(i * k);
+    }
+    if (k == 0 || num_queries == 0) {
+        return true;
+    }
+    const int64_t num_blocks =
+            (num_queries + SEARCH_BATCH_BLOCK_SIZE - 1) /
+            SEARCH_BATCH_BLOCK_SIZE;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<size_t> block_indices;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t b = 0; b < num_blocks; b++) {
+            const int64_t begin = b * SEARCH_BATCH_BLOCK_SIZE;
+            const int64_t rows = std::min(SEARCH_BATCH_BLOCK_SIZE,
+                                          num_queries - begin);
+            block_indices.resize(rows * k);
+            flann::Matrix<double> query_flann(
+                    (double *)queries.data() + begin * dimension_, rows,
+                    dimension_);
+            flann::Matrix<size_t> indices_flann(block_indices.data(), rows, k);
+            flann::Matrix<double> dists_flann(distance2.data() + begin * k,
+                                              rows, k);
+            flann_index_->knnSearch(
+                    query_flann, indices_flann, dists_flann, k,
+                    flann::SearchParams(GetSearchChecks(), 0.0));
+            std::copy(block_indices.begin(), block_indices.end(),
+                      indices.begin() + begin * k);
+        }
+    }
+    return true;
+}
+
+bool KDTreeFlann::SearchRadiusBatchRaw(
+        const Eigen::Map<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_) {
+        return false;
+    }
+    const int64_t num_queries = queries.cols();
+    offsets.assign(num_queries + 1, 0);
+    if (num_queries == 0 || max_nn == 0) {
+        indices.clear();
+        distance2.clear();
+        return true;
+    }
+    const int64_t num_blocks =
+            (num_queries + SEARCH_BATCH_BLOCK_SIZE - 1) /
+            SEARCH_BATCH_BLOCK_SIZE;
+    if (max_nn == 1) {
+        // At most one neighbor per query, e.g. the correspondences of ICP.
+        // The results are written to the slot of their query in the outputs
+        // and compacted afterwards, so that repeated searches reuse the
+        // capacity of the outputs and allocate nothing else.
+        indices.resize(num_queries);
+        distance2.resize(num_queries);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            flann::SearchParams param(GetSearchChecks(), 0.0);
+            param.max_neighbors = 1;
+            std::array<size_t, SEARCH_BATCH_BLOCK_SIZE> block_indices;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (int64_t b = 0; b < num_blocks; b++) {
+                const int64_t begin = b * SEARCH_BATCH_BLOCK_SIZE;
+                const int64_t rows = std::min(SEARCH_BATCH_BLOCK_SIZE,
+                                              num_queries - begin);
+                flann::Matrix<double> query_flann(
+                        (double *)queries.data() + begin * dimension_, rows,
+                        dimension_);
+                flann::Matrix<size_t> indices_flann(block_indices.data(), rows,
+                                                    1);
+                flann::Matrix<double> dists_flann(distance2.data() + begin,
+                                                  rows, 1);
+                flann_index_->radiusSearch(query_flann, indices_flann,
+                                           dists_flann, float(radius * radius),
+                                           param);
+                for (int64_t i = 0; i < rows; i++) {
+                    bool found = block_indices[i] != size_t(-1);
+                    indices[begin + i] = found ? int(block_indices[i]) : -1;
+                    offsets[begin + i + 1] = found ? 1 : 0;
+                }
+            }
+        }
+        // offsets[i + 1] holds the neighbor count of query i until it is
+        // replaced by the running total.
+        size_t n = 0;
+        for (int64_t i = 0; i < num_queries; i++) {
+            if (offsets[i + 1] > 0) {
+                indices[n] = indices[i];
+                distance2[n] = distance2[i];
+                n++;
+            }
+            offsets[i + 1] = n;
+        }
+        indices.resize(n);
+        distance2.resize(n);
+        return true;
+    }
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<double>> block_dists(num_blocks);
+    std::vector<std::vector<size_t>> block_counts(num_blocks);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        flann::SearchParams param(GetSearchChecks(), 0.0);
+        param.max_neighbors = max_nn;
+        // With max_nn > 0 the results go to a fixed-size matrix, FLANN marks
+        // the end of a shorter row with size_t(-1). Otherwise FLANN manages
+        // the per-query vectors.
+        std::vector<size_t> fixed_indices;
+        std::vector<double> fixed_dists;
+        std::vector<std::vector<size_t>> indices_vec;
+        std::vector<std::vector<double>> dists_vec;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t b = 0; b < num_blocks; b++) {
+            const int64_t begin = b * SEARCH_BATCH_BLOCK_SIZE;
+            const int64_t rows = std::min(SEARCH_BATCH_BLOCK_SIZE,
+                                          num_queries - begin);
+            flann::Matrix<double> query_flann(
+                    (double *)queries.data() + begin * dimension_, rows,
+                    dimension_);
+            std::vector<size_t> &counts = block_counts[b];
+            counts.resize(rows);
+            if (max_nn > 0) {
+                fixed_indices.resize(rows * max_nn);
+                fixed_dists.resize(rows * max_nn);
+                flann::Matrix<size_t> indices_flann(fixed_indices.data(), rows,
+                                                    max_nn);
+                flann::Matrix<double> dists_flann(fixed_dists.data(), rows,
+                                                  max_nn);
+                int total = flann_index_->radiusSearch(
+                        query_flann, indices_flann, dists_flann,
+                        float(radius * radius), param);
+                block_indices[b].reserve(total);
+                block_dists[b].reserve(total);
+                for (int64_t i = 0; i < rows; i++) {
+                    size_t n = 0;
+                    const size_t *row = indices_flann[i];
+                    while (n < size_t(max_nn) && row[n] != size_t(-1)) {
+                        block_indices[b].push_back(int(row[n]));
+                        block_dists[b].push_back(dists_flann[i][n]);
+                        n++;
+                    }
+                    counts[i] = n;
+                }
+            } else {
+                flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
+                                           float(radius * radius), param);
+                size_t total = 0;
+                for (int64_t i = 0; i < rows; i++) {
+                    counts[i] = indices_vec[i].size();
+                    total += counts[i];
+                }
+                block_indices[b].reserve(total);
+                block_dists[b].reserve(total);
+                for (int64_t i = 0; i < rows; i++) {
+                    block_indices[b].insert(block_indices[b].end(),
+                                            indices_vec[i].begin(),
+                                            indices_vec[i].end());
+                    block_dists[b].insert(block_dists[b].end(),
+                                          dists_vec[i].begin(),
+                                          dists_vec[i].end());
+                }
+            }
+        }
+    }
+    MergeBlockResults(block_indices, block_dists, block_counts,
+                      SEARCH_BATCH_BLOCK_SIZE, indices, distance2, offsets);
+    return true;
+}
+
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     dimension_ = data.rows();
     dataset_size_ = data.cols();
@@ -198,12 +569,22 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
            dataset_size_ * dimension_ * sizeof(double));
     flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
                                                    dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
-            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+    if (index_param_.IsApproximate()) {
+        flann_index_.reset(new flann::Index<flann::L2<double>>(
+                *flann_dataset_,
+                flann::KDTreeIndexParams(index_param_.num_trees_)));
+    } else {
+        flann_index_.reset(new flann::Index<flann::L2<double>>(
+                *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+    }
     flann_index_->buildIndex();
     return true;
 }
 
+int KDTreeFlann::GetSearchChecks() const {
+    return index_param_.IsApproximate() ? index_param_.checks_ : -1;
+}
+
 template int KDTreeFlann::Search<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         const KDTreeSearchParam &param,
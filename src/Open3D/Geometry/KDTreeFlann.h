@@ -55,17 +55,28 @@ public:
     KDTreeFlann();
     /// \brief Parameterized Constructor.
     ///
+    /// \param index_param Index used once data is set, exact by default.
+    explicit KDTreeFlann(const KDTreeIndexParam &index_param);
+    /// \brief Parameterized Constructor.
+    ///
     /// \param data Provides set of data points for KDTree construction.
-    KDTreeFlann(const Eigen::MatrixXd &data);
+    /// \param index_param Index to build, exact by default.
+    KDTreeFlann(const Eigen::MatrixXd &data,
+                const KDTreeIndexParam &index_param = KDTreeIndexParam());
     /// \brief Parameterized Constructor.
     ///
     /// \param geometry Provides geometry from which KDTree is constructed.
-    KDTreeFlann(const Geometry &geometry);
+    /// \param index_param Index to build, exact by default.
+    KDTreeFlann(const Geometry &geometry,
+                const KDTreeIndexParam &index_param = KDTreeIndexParam());
     /// \brief Parameterized Constructor.
     ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
-    KDTreeFlann(const registration::Feature &feature);
+    /// \param index_param Index to build, exact by default. Approximate
+    /// indices speed up the matching of large sets of features.
+    KDTreeFlann(const registration::Feature &feature,
+                const KDTreeIndexParam &index_param = KDTreeIndexParam());
     ~KDTreeFlann();
     KDTreeFlann(const KDTreeFlann &) = delete;
     KDTreeFlann &operator=(const KDTreeFlann &) = delete;
@@ -83,6 +94,8 @@ public:
     ///
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const registration::Feature &feature);
+    /// Returns the number of indexed points.
+    size_t GetDataSize() const { return dataset_size_; }
 
     template <typename T>
     int Search(const T &query,
@@ -109,12 +122,90 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Searches the neighbors of many queries at once.
+    ///
+    /// The queries are split into blocks that are searched in parallel, with
+    /// one FLANN call and no per-query allocation per block. The results are
+    /// returned in a compressed sparse row (CSR) layout: the neighbors of
+    /// query i are indices[offsets[i]:offsets[i + 1]], with squared distances
+    /// in distance2 at the same positions, sorted by increasing distance.
+    ///
+    /// \param queries Query points, one per column (dimension x num_queries).
+    /// \param param Search parameters.
+    /// \param indices Output neighbor indices of all queries.
+    /// \param distance2 Output squared distances of all queries.
+    /// \param offsets Output offsets, of size num_queries + 1.
+    /// \return false if the tree is empty or the query dimension mismatches.
+    bool SearchBatch(const Eigen::MatrixXd &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<size_t> &offsets) const;
+    bool SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<size_t> &offsets) const;
+
+    /// \brief Batched version of SearchKNN, see SearchBatch.
+    bool SearchKNNBatch(const Eigen::MatrixXd &queries,
+                        int knn,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2,
+                        std::vector<size_t> &offsets) const;
+    bool SearchKNNBatch(const std::vector<Eigen::Vector3d> &queries,
+                        int knn,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2,
+                        std::vector<size_t> &offsets) const;
+
+    /// \brief Batched version of SearchRadius, see SearchBatch.
+    bool SearchRadiusBatch(const Eigen::MatrixXd &queries,
+                           double radius,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) const;
+    bool SearchRadiusBatch(const std::vector<Eigen::Vector3d> &queries,
+                           double radius,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) const;
+
+    /// \brief Batched version of SearchHybrid, see SearchBatch.
+    bool SearchHybridBatch(const Eigen::MatrixXd &queries,
+                           double radius,
+                           int max_nn,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) const;
+    bool SearchHybridBatch(const std::vector<Eigen::Vector3d> &queries,
+                           double radius,
+                           int max_nn,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
     /// Internal method that sets all the members of KDTree by data provided by
     /// features, geometry, etc.
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    /// Number of leaf checks passed to FLANN, -1 (unlimited) for exact search.
+    int GetSearchChecks() const;
+
+    /// Internal implementations of the batched searches on mapped queries.
+    bool SearchKNNBatchRaw(const Eigen::Map<const Eigen::MatrixXd> &queries,
+                           int knn,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) const;
+    bool SearchRadiusBatchRaw(const Eigen::Map<const Eigen::MatrixXd> &queries,
+                              double radius,
+                              int max_nn,
+                              std::vector<int> &indices,
+                              std::vector<double> &distance2,
+                              std::vector<size_t> &offsets) const;
 
 protected:
     std::vector<double> data_;
@@ -122,6 +213,7 @@ protected:
     std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
+    KDTreeIndexParam index_param_;
 };
 
 }  // namespace geometry
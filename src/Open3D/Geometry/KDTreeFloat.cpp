@@ -0,0 +1,601 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/KDTreeFloat.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of leaf points whose distances are computed together.
+static constexpr int LEAF_SCAN_WIDTH = 16;
+
+/// Number of queries handled by one task in the batched search.
+static constexpr int64_t SEARCH_BATCH_BLOCK_SIZE = 256;
+
+/// Returns false for negative neighbor counts, non-positive radii and unknown
+/// search types.
+bool IsValidSearchParam(const KDTreeSearchParam &param) {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return ((const KDTreeSearchParamKNN &)param).knn_ >= 0;
+        case KDTreeSearchParam::SearchType::Radius:
+            return ((const KDTreeSearchParamRadius &)param).radius_ > 0.0;
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return ((const KDTreeSearchParamHybrid &)param).max_nn_ >= 0;
+        default:
+            return false;
+    }
+}
+
+/// Keeps the k closest points with squared distance below max_dist2, sorted
+/// by increasing distance. Used by the KNN and hybrid searches.
+class KNNResultSet {
+public:
+    KNNResultSet(int k,
+                 float max_dist2,
+                 std::vector<int> &indices,
+                 std::vector<float> &dists)
+        : k_(size_t(k)),
+          max_dist2_(max_dist2),
+          indices_(indices),
+          dists_(dists) {
+        indices_.clear();
+        dists_.clear();
+    }
+
+    float WorstDist() const {
+        return dists_.size() < k_ ? max_dist2_ : dists_.back();
+    }
+
+    void AddPoint(float dist2, int index) {
+        if (dists_.size() < k_) {
+            dists_.push_back(dist2);
+            indices_.push_back(index);
+        } else {
+            dists_.back() = dist2;
+            indices_.back() = index;
+        }
+        size_t i = dists_.size() - 1;
+        while (i > 0 && dists_[i - 1] > dist2) {
+            dists_[i] = dists_[i - 1];
+            indices_[i] = indices_[i - 1];
+            i--;
+        }
+        dists_[i] = dist2;
+        indices_[i] = index;
+    }
+
+    void Finalize() {}
+
+private:
+    size_t k_;
+    float max_dist2_;
+    std::vector<int> &indices_;
+    std::vector<float> &dists_;
+};
+
+/// Keeps all points with squared distance below max_dist2, sorted by
+/// increasing distance once the search is done.
+class RadiusResultSet {
+public:
+    RadiusResultSet(float max_dist2,
+                    std::vector<int> &indices,
+                    std::vector<float> &dists)
+        : max_dist2_(max_dist2), indices_(indices), dists_(dists) {
+        indices_.clear();
+        dists_.clear();
+    }
+
+    float WorstDist() const { return max_dist2_; }
+
+    void AddPoint(float dist2, int index) {
+        dists_.push_back(dist2);
+        indices_.push_back(index);
+    }
+
+    void Finalize() {
+        order_.resize(dists_.size());
+        std::iota(order_.begin(), order_.end(), 0);
+        std::sort(order_.begin(), order_.end(), [this](int a, int b) {
+            return dists_[a] < dists_[b] ||
+                   (dists_[a] == dists_[b] && indices_[a] < indices_[b]);
+        });
+        sorted_indices_.resize(order_.size());
+        sorted_dists_.resize(order_.size());
+        for (size_t i = 0; i < order_.size(); i++) {
+            sorted_indices_[i] = indices_[order_[i]];
+            sorted_dists_[i] = dists_[order_[i]];
+        }
+        indices_.swap(sorted_indices_);
+        dists_.swap(sorted_dists_);
+    }
+
+private:
+    float max_dist2_;
+    std::vector<int> &indices_;
+    std::vector<float> &dists_;
+    std::vector<int> order_;
+    std::vector<int> sorted_indices_;
+    std::vector<float> sorted_dists_;
+};
+
+}  // unnamed namespace
+
+template <int Dim>
+KDTreeFloat<Dim>::KDTreeFloat(int leaf_size /* = 16 */)
+    : leaf_size_(std::max(leaf_size, 1)) {}
+
+template <int Dim>
+KDTreeFloat<Dim>::KDTreeFloat(const Eigen::MatrixXd &data,
+                              int leaf_size /* = 16 */)
+    : leaf_size_(std::max(leaf_size, 1)) {
+    SetMatrixData(data);
+}
+
+template <int Dim>
+KDTreeFloat<Dim>::KDTreeFloat(const Geometry &geometry,
+                              int leaf_size /* = 16 */)
+    : leaf_size_(std::max(leaf_size, 1)) {
+    SetGeometry(geometry);
+}
+
+template <int Dim>
+KDTreeFloat<Dim>::~KDTreeFloat() {}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::SetMatrixData(const Eigen::MatrixXd &data) {
+    return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+            data.data(), data.rows(), data.cols()));
+}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::SetGeometry(const Geometry &geometry) {
+    switch (geometry.GetGeometryType()) {
+        case Geometry::GeometryType::PointCloud:
+            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+                    (const double *)((const PointCloud &)geometry)
+                            .points_.data(),
+                    3, ((const PointCloud &)geometry).points_.size()));
+        case Geometry::GeometryType::TriangleMesh:
+        case Geometry::GeometryType::HalfEdgeTriangleMesh:
+            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+                    (const double *)((const TriangleMesh &)geometry)
+                            .vertices_.data(),
+                    3, ((const TriangleMesh &)geometry).vertices_.size()));
+        case Geometry::GeometryType::Image:
+        case Geometry::GeometryType::Unspecified:
+        default:
+            utility::LogWarning(
+                    "[KDTreeFloat::SetGeometry] Unsupported Geometry type.");
+            return false;
+    }
+}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::SetRawData(
+        const Eigen::Map<const Eigen::MatrixXd> &data) {
+    for (int d = 0; d < Dim; d++) {
+        coords_[d].clear();
+    }
+    indices_.clear();
+    nodes_.clear();
+    removed_.clear();
+    removed_count_ = 0;
+    if (data.rows() != Dim) {
+        utility::LogWarning(
+                "[KDTreeFloat::SetRawData] Data dimension {} does not match "
+                "the tree dimension {}.",
+                data.rows(), Dim);
+        return false;
+    }
+    if (data.cols() == 0) {
+        utility::LogWarning("[KDTreeFloat::SetRawData] Failed due to no data.");
+        return false;
+    }
+    if (data.cols() > int64_t(std::numeric_limits<int>::max())) {
+        utility::LogWarning(
+                "[KDTreeFloat::SetRawData] Too many points for int indices.");
+        return false;
+    }
+    const int num_points = int(data.cols());
+    for (int d = 0; d < Dim; d++) {
+        coords_[d].resize(num_points);
+        min_bound_[d] = std::numeric_limits<float>::max();
+        max_bound_[d] = std::numeric_limits<float>::lowest();
+    }
+    for (int i = 0; i < num_points; i++) {
+        for (int d = 0; d < Dim; d++) {
+            float value = float(data(d, i));
+            coords_[d][i] = value;
+            min_bound_[d] = std::min(min_bound_[d], value);
+            max_bound_[d] = std::max(max_bound_[d], value);
+        }
+    }
+
+    indices_.resize(num_points);
+    std::iota(indices_.begin(), indices_.end(), 0);
+    nodes_.reserve(2 * (num_points / leaf_size_ + 1));
+    BuildNode(indices_, 0, num_points);
+
+    // Reorder the coordinates so that every leaf is a contiguous range.
+    std::vector<float> reordered(num_points);
+    for (int d = 0; d < Dim; d++) {
+        for (int i = 0; i < num_points; i++) {
+            reordered[i] = coords_[d][indices_[i]];
+        }
+        coords_[d].swap(reordered);
+    }
+    return true;
+}
+
+template <int Dim>
+typename KDTreeFloat<Dim>::QueryType KDTreeFloat<Dim>::GetStoredPoint(
+        int position) const {
+    QueryType point;
+    for (int d = 0; d < Dim; d++) {
+        point(d) = coords_[d][position];
+    }
+    return point;
+}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::RemovePoint(int index) {
+    if (index < 0 || size_t(index) >= indices_.size()) {
+        return false;
+    }
+    if (removed_.empty()) {
+        removed_.resize(indices_.size(), 0);
+    }
+    if (removed_[index]) {
+        return false;
+    }
+    removed_[index] = 1;
+    removed_count_++;
+    return true;
+}
+
+template <int Dim>
+int KDTreeFloat<Dim>::BuildNode(std::vector<int> &order, int begin, int end) {
+    // The coordinates are still in input order here, order holds the
+    // permutation being built.
+    int node_id = int(nodes_.size());
+    nodes_.push_back(Node{begin, end, -1, -1, 0, 0.0f, 0.0f});
+    if (end - begin <= leaf_size_) {
+        return node_id;
+    }
+
+    int split_dim = 0;
+    float max_spread = 0.0f;
+    for (int d = 0; d < Dim; d++) {
+        float lo = std::numeric_limits<float>::max();
+        float hi = std::numeric_limits<float>::lowest();
+        for (int i = begin; i < end; i++) {
+            float value = coords_[d][order[i]];
+            lo = std::min(lo, value);
+            hi = std::max(hi, value);
+        }
+        if (hi - lo > max_spread) {
+            max_spread = hi - lo;
+            split_dim = d;
+        }
+    }
+    if (max_spread <= 0.0f) {
+        // All points are identical, keep them in one leaf.
+        return node_id;
+    }
+
+    const std::vector<float> &axis = coords_[split_dim];
+    int mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid,
+                     order.begin() + end,
+                     [&axis](int a, int b) { return axis[a] < axis[b]; });
+    float low = std::numeric_limits<float>::lowest();
+    for (int i = begin; i < mid; i++) {
+        low = std::max(low, axis[order[i]]);
+    }
+    float high = axis[order[mid]];
+
+    int left = BuildNode(order, begin, mid);
+    int right = BuildNode(order, mid, end);
+    Node &node = nodes_[node_id];
+    node.left_ = left;
+    node.right_ = right;
+    node.split_dim_ = split_dim;
+    node.low_ = low;
+    node.high_ = high;
+    return node_id;
+}
+
+template <int Dim>
+template <typename ResultSet>
+void KDTreeFloat<Dim>::SearchTree(const float *query,
+                                  ResultSet &result) const {
+    // Squared distance from the query to the bounding box of the data, kept
+    // per axis so that it can be updated incrementally while descending.
+    std::array<float, Dim> axis_dists;
+    float min_dist = 0.0f;
+    for (int d = 0; d < Dim; d++) {
+        float diff = 0.0f;
+        if (query[d] < min_bound_[d]) {
+            diff = min_bound_[d] - query[d];
+        } else if (query[d] > max_bound_[d]) {
+            diff = query[d] - max_bound_[d];
+        }
+        axis_dists[d] = diff * diff;
+        min_dist += axis_dists[d];
+    }
+    if (min_dist < result.WorstDist()) {
+        SearchNode(0, query, min_dist, axis_dists, result);
+    }
+    result.Finalize();
+}
+
+template <int Dim>
+template <typename ResultSet>
+void KDTreeFloat<Dim>::SearchNode(int node_id,
+                                  const float *query,
+                                  float min_dist,
+                                  std::array<float, Dim> &axis_dists,
+                                  ResultSet &result) const {
+    const Node &node = nodes_[node_id];
+    if (node.left_ < 0) {
+        float dists[LEAF_SCAN_WIDTH];
+        for (int start = node.begin_; start < node.end_;
+             start += LEAF_SCAN_WIDTH) {
+            const int count = std::min(LEAF_SCAN_WIDTH, node.end_ - start);
+            // Structure-of-arrays scan, vectorized by the compiler.
+            for (int j = 0; j < count; j++) {
+                dists[j] = 0.0f;
+            }
+            for (int d = 0; d < Dim; d++) {
+                const float *axis = coords_[d].data() + start;
+                const float q = query[d];
+                for (int j = 0; j < count; j++) {
+                    float diff = axis[j] - q;
+                    dists[j] += diff * diff;
+                }
+            }
+            for (int j = 0; j < count; j++) {
+                const int index = indices_[start + j];
+                if (dists[j] < result.WorstDist() &&
+                    (removed_count_ == 0 || !removed_[index])) {
+                    result.AddPoint(dists[j], index);
+                }
+            }
+        }
+        return;
+    }
+
+    const int d = node.split_dim_;
+    const float diff_low = query[d] - node.low_;
+    const float diff_high = query[d] - node.high_;
+    int near_child, far_child;
+    float cut_dist;
+    if (diff_low + diff_high < 0.0f) {
+        near_child = node.left_;
+        far_child = node.right_;
+        cut_dist = diff_high * diff_high;
+    } else {
+        near_child = node.right_;
+        far_child = node.left_;
+        cut_dist = diff_low * diff_low;
+    }
+    SearchNode(near_child, query, min_dist, axis_dists, result);
+
+    const float saved_dist = axis_dists[d];
+    min_dist += cut_dist - saved_dist;
+    if (min_dist < result.WorstDist()) {
+        axis_dists[d] = cut_dist;
+        SearchNode(far_child, query, min_dist, axis_dists, result);
+        axis_dists[d] = saved_dist;
+    }
+}
+
+template <int Dim>
+void KDTreeFloat<Dim>::SearchQuery(const float *query,
+                                   const KDTreeSearchParam &param,
+                                   std::vector<int> &indices,
+                                   std::vector<float> &dists) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn: {
+            int knn = ((const KDTreeSearchParamKNN &)param).knn_;
+            KNNResultSet result(knn, std::numeric_limits<float>::max(),
+                                indices, dists);
+            if (knn > 0) {
+                SearchTree(query, result);
+            }
+            break;
+        }
+        case KDTreeSearchParam::SearchType::Radius: {
+            double radius = ((const KDTreeSearchParamRadius &)param).radius_;
+            RadiusResultSet result(float(radius * radius), indices, dists);
+            SearchTree(query, result);
+            break;
+        }
+        case KDTreeSearchParam::SearchType::Hybrid: {
+            const auto &hybrid = (const KDTreeSearchParamHybrid &)param;
+            KNNResultSet result(hybrid.max_nn_,
+                                float(hybrid.radius_ * hybrid.radius_),
+                                indices, dists);
+            if (hybrid.max_nn_ > 0) {
+                SearchTree(query, result);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+template <int Dim>
+int KDTreeFloat<Dim>::Search(const QueryType &query,
+                             const KDTreeSearchParam &param,
+                             std::vector<int> &indices,
+                             std::vector<double> &distance2) const {
+    if (nodes_.empty() || !IsValidSearchParam(param)) {
+        return -1;
+    }
+    float query_float[Dim];
+    for (int d = 0; d < Dim; d++) {
+        query_float[d] = float(query(d));
+    }
+    std::vector<float> dists;
+    SearchQuery(query_float, param, indices, dists);
+    distance2.assign(dists.begin(), dists.end());
+    return int(indices.size());
+}
+
+template <int Dim>
+int KDTreeFloat<Dim>::SearchKNN(const QueryType &query,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<double> &distance2) const {
+    return Search(query, KDTreeSearchParamKNN(knn), indices, distance2);
+}
+
+template <int Dim>
+int KDTreeFloat<Dim>::SearchRadius(const QueryType &query,
+                                   double radius,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    return Search(query, KDTreeSearchParamRadius(radius), indices, distance2);
+}
+
+template <int Dim>
+int KDTreeFloat<Dim>::SearchHybrid(const QueryType &query,
+                                   double radius,
+                                   int max_nn,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    return Search(query, KDTreeSearchParamHybrid(radius, max_nn), indices,
+                  distance2);
+}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::SearchBatch(const Eigen::MatrixXd &queries,
+                                   const KDTreeSearchParam &param,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2,
+                                   std::vector<size_t> &offsets) const {
+    return SearchBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            param, indices, distance2, offsets);
+}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                                   const KDTreeSearchParam &param,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2,
+                                   std::vector<size_t> &offsets) const {
+    return SearchBatchRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            param, indices, distance2, offsets);
+}
+
+template <int Dim>
+bool KDTreeFloat<Dim>::SearchBatchRaw(
+        const Eigen::Map<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    if (nodes_.empty() || queries.rows() != Dim ||
+        !IsValidSearchParam(param)) {
+        return false;
+    }
+    const int64_t num_queries = queries.cols();
+    const int64_t num_blocks =
+            (num_queries + SEARCH_BATCH_BLOCK_SIZE - 1) /
+            SEARCH_BATCH_BLOCK_SIZE;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<float>> block_dists(num_blocks);
+    offsets.assign(num_queries + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> query_indices;
+        std::vector<float> query_dists;
+        float query[Dim];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t b = 0; b < num_blocks; b++) {
+            const int64_t begin = b * SEARCH_BATCH_BLOCK_SIZE;
+            const int64_t end =
+                    std::min(begin + SEARCH_BATCH_BLOCK_SIZE, num_queries);
+            for (int64_t i = begin; i < end; i++) {
+                for (int d = 0; d < Dim; d++) {
+                    query[d] = float(queries(d, i));
+                }
+                SearchQuery(query, param, query_indices, query_dists);
+                // Counts for now, turned into offsets below.
+                offsets[i + 1] = query_indices.size();
+                block_indices[b].insert(block_indices[b].end(),
+                                        query_indices.begin(),
+                                        query_indices.end());
+                block_dists[b].insert(block_dists[b].end(),
+                                      query_dists.begin(), query_dists.end());
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < num_queries; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets.back());
+    distance2.resize(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t b = 0; b < num_blocks; b++) {
+        const size_t start = offsets[b * SEARCH_BATCH_BLOCK_SIZE];
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  indices.begin() + start);
+        std::copy(block_dists[b].begin(), block_dists[b].end(),
+                  distance2.begin() + start);
+    }
+    return true;
+}
+
+template class KDTreeFloat<2>;
+template class KDTreeFloat<3>;
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class KDTreeFloat
+///
+/// \brief KDTree with float32 storage and compile-time dimension.
+///
+/// A lighter alternative to KDTreeFlann for low-dimensional point data such
+/// as 3D point clouds. The points are stored once, in single precision, as one
+/// array per coordinate (SoA) in leaf order, so a leaf bucket is a contiguous
+/// range of every array and the distances of a leaf are computed with a
+/// vectorizable loop. This needs 4 * (Dim + 1) bytes per point instead of the
+/// double precision copies kept by KDTreeFlann and FLANN.
+///
+/// Distances are computed in single precision, so coordinates far from the
+/// origin (e.g. georeferenced scans) should be centered before building the
+/// tree.
+template <int Dim>
+class KDTreeFloat {
+public:
+    typedef Eigen::Matrix<double, Dim, 1> QueryType;
+
+    /// \brief Default Constructor.
+    ///
+    /// \param leaf_size Maximum number of points in a leaf bucket.
+    KDTreeFloat(int leaf_size = 16);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param data Data points for KDTree construction, one per column.
+    /// \param leaf_size Maximum number of points in a leaf bucket.
+    KDTreeFloat(const Eigen::MatrixXd &data, int leaf_size = 16);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param geometry Geometry whose points are used for KDTree construction.
+    /// \param leaf_size Maximum number of points in a leaf bucket.
+    KDTreeFloat(const Geometry &geometry, int leaf_size = 16);
+    ~KDTreeFloat();
+    KDTreeFloat(const KDTreeFloat &) = default;
+    KDTreeFloat &operator=(const KDTreeFloat &) = default;
+
+public:
+    /// Sets the data for the KDTree from a matrix with Dim rows.
+    bool SetMatrixData(const Eigen::MatrixXd &data);
+    /// Sets the data for the KDTree from the points of a PointCloud or the
+    /// vertices of a TriangleMesh. Only valid for Dim == 3.
+    bool SetGeometry(const Geometry &geometry);
+
+    /// Returns the number of points in the tree, including removed ones.
+    size_t GetDataSize() const { return indices_.size(); }
+
+    /// \brief Marks a point as removed.
+    ///
+    /// The point keeps its index but is skipped by all subsequent searches,
+    /// without rebuilding the tree. Returns false if the index is out of
+    /// range or the point was already removed.
+    bool RemovePoint(int index);
+    /// Returns the number of removed points.
+    size_t GetRemovedCount() const { return removed_count_; }
+
+    /// \brief Returns the point stored at a position, in single precision.
+    ///
+    /// The points are stored in leaf order at the positions
+    /// [0, GetDataSize()), which lets containers built on top of the tree
+    /// read the coordinates back instead of keeping their own copy.
+    QueryType GetStoredPoint(int position) const;
+    /// Returns the index of the point stored at a position.
+    int GetStoredIndex(int position) const { return indices_[position]; }
+
+    /// The single-query searches follow the conventions of KDTreeFlann: they
+    /// return the number of neighbors found, sorted by increasing squared
+    /// distance, or -1 on invalid input.
+    int Search(const QueryType &query,
+               const KDTreeSearchParam &param,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) const;
+    int SearchKNN(const QueryType &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) const;
+    int SearchRadius(const QueryType &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+    int SearchHybrid(const QueryType &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// \brief Searches the neighbors of many queries in parallel.
+    ///
+    /// Same CSR output layout as KDTreeFlann::SearchBatch: the neighbors of
+    /// query i are indices[offsets[i]:offsets[i + 1]].
+    bool SearchBatch(const Eigen::MatrixXd &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<size_t> &offsets) const;
+    bool SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2,
+                     std::vector<size_t> &offsets) const;
+
+private:
+    /// Inner node if left_ >= 0, otherwise a leaf holding the points
+    /// [begin_, end_) of the SoA arrays.
+    struct Node {
+        int begin_;
+        int end_;
+        int left_;
+        int right_;
+        int split_dim_;
+        /// Largest coordinate of the left child and smallest coordinate of
+        /// the right child along split_dim_.
+        float low_;
+        float high_;
+    };
+
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    bool SearchBatchRaw(const Eigen::Map<const Eigen::MatrixXd> &queries,
+                        const KDTreeSearchParam &param,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2,
+                        std::vector<size_t> &offsets) const;
+    int BuildNode(std::vector<int> &order, int begin, int end);
+    /// Searches a single query, storing the neighbors in indices and dists.
+    /// The search parameters must be valid.
+    void SearchQuery(const float *query,
+                     const KDTreeSearchParam &param,
+                     std::vector<int> &indices,
+                     std::vector<float> &dists) const;
+    template <typename ResultSet>
+    void SearchTree(const float *query, ResultSet &result) const;
+    template <typename ResultSet>
+    void SearchNode(int node_id,
+                    const float *query,
+                    float min_dist,
+                    std::array<float, Dim> &axis_dists,
+                    ResultSet &result) const;
+
+private:
+    int leaf_size_;
+    std::array<std::vector<float>, Dim> coords_;
+    std::vector<int> indices_;
+    std::vector<Node> nodes_;
+    /// Removal flag per original index, empty until a point is removed.
+    std::vector<uint8_t> removed_;
+    size_t removed_count_ = 0;
+    std::array<float, Dim> min_bound_;
+    std::array<float, Dim> max_bound_;
+};
+
+typedef KDTreeFloat<3> KDTreeFloat3D;
+
+}  // namespace geometry
+}  // namespace open3d
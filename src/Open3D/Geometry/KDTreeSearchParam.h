@@ -111,5 +111,35 @@ public:
     int max_nn_;
 };
 
+/// \class KDTreeIndexParam
+///
+/// \brief KDTree index parameters, selecting exact or approximate search.
+///
+/// By default the index is a single KDTree searched exactly. With num_trees >
+/// 0 it is a forest of randomized KDTrees in which a query visits at most
+/// `checks` leaves, trading recall for speed. Approximate search is meant for
+/// high-dimensional data such as 33-D FPFH features, where exact search
+/// degrades to an almost linear scan.
+class KDTreeIndexParam {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param num_trees Number of randomized trees, 0 for exact search.
+    /// \param checks Maximum number of leaves visited per query in
+    /// approximate search. Higher values give higher recall.
+    KDTreeIndexParam(int num_trees = 0, int checks = 128)
+        : num_trees_(num_trees), checks_(checks) {}
+
+public:
+    /// Returns true if the index is searched approximately.
+    bool IsApproximate() const { return num_trees_ > 0; }
+
+public:
+    /// Number of randomized trees, 0 for exact search.
+    int num_trees_;
+    /// Maximum number of leaves visited per query in approximate search.
+    int checks_;
+};
+
 }  // namespace geometry
 }  // namespace open3d
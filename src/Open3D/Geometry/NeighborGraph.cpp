@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborGraph.h"
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+NeighborGraph::NeighborGraph(const PointCloud &cloud,
+                             const KDTreeSearchParam &search_param) {
+    Build(cloud, search_param);
+}
+
+NeighborGraph::NeighborGraph(const PointCloud &cloud,
+                             const KDTreeSearchParam &search_param,
+                             const KDTreeFlann &kdtree) {
+    Build(cloud, search_param, kdtree);
+}
+
+bool NeighborGraph::Build(const PointCloud &cloud,
+                          const KDTreeSearchParam &search_param) {
+    if (!cloud.HasPoints()) {
+        Clear();
+        return false;
+    }
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(cloud);
+    return Build(cloud, search_param, kdtree);
+}
+
+bool NeighborGraph::Build(const PointCloud &cloud,
+                          const KDTreeSearchParam &search_param,
+                          const KDTreeFlann &kdtree) {
+    Clear();
+    if (kdtree.GetDataSize() != cloud.points_.size()) {
+        utility::LogWarning(
+                "[NeighborGraph::Build] KDTree has {} points but the point "
+                "cloud has {}.",
+                kdtree.GetDataSize(), cloud.points_.size());
+        return false;
+    }
+    search_type_ = search_param.GetSearchType();
+    switch (search_type_) {
+        case KDTreeSearchParam::SearchType::Knn:
+            max_nn_ = ((const KDTreeSearchParamKNN &)search_param).knn_;
+            break;
+        case KDTreeSearchParam::SearchType::Radius:
+            radius_ = ((const KDTreeSearchParamRadius &)search_param).radius_;
+            break;
+        case KDTreeSearchParam::SearchType::Hybrid:
+            radius_ = ((const KDTreeSearchParamHybrid &)search_param).radius_;
+            max_nn_ = ((const KDTreeSearchParamHybrid &)search_param).max_nn_;
+            break;
+    }
+    if (!kdtree.SearchBatch(cloud.points_, search_param, indices_, distance2_,
+                            offsets_)) {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+void NeighborGraph::Clear() {
+    indices_.clear();
+    distance2_.clear();
+    offsets_.clear();
+    search_type_ = KDTreeSearchParam::SearchType::Knn;
+    radius_ = 0.0;
+    max_nn_ = 0;
+}
+
+int NeighborGraph::GetNeighbors(size_t i,
+                                std::vector<int> &indices,
+                                std::vector<double> &distance2) const {
+    indices.assign(indices_.begin() + offsets_[i],
+                   indices_.begin() + offsets_[i + 1]);
+    distance2.assign(distance2_.begin() + offsets_[i],
+                     distance2_.begin() + offsets_[i + 1]);
+    return (int)indices.size();
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class KDTreeFlann;
+class PointCloud;
+
+/// \class NeighborGraph
+///
+/// \brief Neighborhoods of all the points of a point cloud, stored as a
+/// compressed sparse row (CSR) adjacency with squared distances.
+///
+/// The graph is built once with batched, parallel KDTree searches and can be
+/// passed to the point cloud operations that would otherwise search the same
+/// neighborhoods again: PointCloud::EstimateNormals,
+/// PointCloud::RemoveStatisticalOutliers, PointCloud::ClusterDBSCAN,
+/// PointCloud::ComputeNearestNeighborDistance and
+/// registration::ComputeFPFHFeature. The neighbors of point i are
+/// indices_[offsets_[i]:offsets_[i + 1]], sorted by increasing distance, and
+/// include point i itself.
+class NeighborGraph {
+public:
+    /// \brief Default Constructor.
+    NeighborGraph() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud Point cloud whose neighborhoods are searched.
+    /// \param search_param Search parameters of the neighborhoods.
+    NeighborGraph(const PointCloud &cloud,
+                  const KDTreeSearchParam &search_param);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud Point cloud whose neighborhoods are searched.
+    /// \param search_param Search parameters of the neighborhoods.
+    /// \param kdtree Prebuilt KDTree on the points of the cloud.
+    NeighborGraph(const PointCloud &cloud,
+                  const KDTreeSearchParam &search_param,
+                  const KDTreeFlann &kdtree);
+    ~NeighborGraph() {}
+
+public:
+    /// Searches the neighborhoods of all the points of the cloud, building a
+    /// temporary KDTree. Returns false if the cloud is empty.
+    bool Build(const PointCloud &cloud, const KDTreeSearchParam &search_param);
+    /// Searches the neighborhoods of all the points of the cloud in a
+    /// prebuilt KDTree. Returns false if the tree does not match the cloud.
+    bool Build(const PointCloud &cloud,
+               const KDTreeSearchParam &search_param,
+               const KDTreeFlann &kdtree);
+    /// Removes all the nodes and edges of the graph.
+    void Clear();
+    /// Returns true if the graph has no nodes.
+    bool IsEmpty() const { return GetNodeCount() == 0; }
+    /// Returns the number of nodes, the number of points of the cloud.
+    size_t GetNodeCount() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+    /// Returns the total number of edges, self edges included.
+    size_t GetEdgeCount() const { return indices_.size(); }
+    /// Returns the number of neighbors of node i, itself included.
+    int GetNeighborCount(size_t i) const {
+        return int(offsets_[i + 1] - offsets_[i]);
+    }
+    /// Copies the neighbors of node i and their squared distances, returns
+    /// the number of neighbors.
+    int GetNeighbors(size_t i,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+    /// Returns the search type the graph was built with.
+    KDTreeSearchParam::SearchType GetSearchType() const {
+        return search_type_;
+    }
+    /// Returns the search radius of Radius and Hybrid graphs, 0 for Knn.
+    double GetRadius() const { return radius_; }
+    /// Returns the maximum number of neighbors of Knn and Hybrid graphs, 0
+    /// for Radius.
+    int GetMaxNN() const { return max_nn_; }
+
+public:
+    /// Neighbor indices of all the nodes.
+    std::vector<int> indices_;
+    /// Squared distances to the neighbors, at the same positions as indices_.
+    std::vector<double> distance2_;
+    /// Offsets of the neighbors of each node, of size GetNodeCount() + 1.
+    std::vector<size_t> offsets_;
+
+private:
+    KDTreeSearchParam::SearchType search_type_ =
+            KDTreeSearchParam::SearchType::Knn;
+    double radius_ = 0.0;
+    int max_nn_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -29,11 +29,14 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <numeric>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -295,6 +298,71 @@ private:
     std::vector<point_cubic_id> original_id;
     std::unordered_map<int, int> classes;
 };
+
+/// Groups the points by voxel. Returns the point indices sorted by voxel, in
+/// input order within each voxel, and the offsets of the voxels in them.
+void GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                        const Eigen::Vector3d &voxel_min_bound,
+                        double voxel_size,
+                        std::vector<int> &order,
+                        std::vector<int> &voxel_offsets) {
+    const int num_points = int(points.size());
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord = (points[i] - voxel_min_bound) / voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                int(floor(ref_coord(2)));
+    }
+    Eigen::Vector3i min_index = Eigen::Vector3i::Zero();
+    Eigen::Vector3i max_index = Eigen::Vector3i::Zero();
+    if (num_points > 0) {
+        min_index = max_index = voxel_indices[0];
+    }
+    for (const Eigen::Vector3i &voxel_index : voxel_indices) {
+        min_index = min_index.cwiseMin(voxel_index);
+        max_index = max_index.cwiseMax(voxel_index);
+    }
+    const Eigen::Matrix<uint64_t, 3, 1> range =
+            (max_index.cast<int64_t>() - min_index.cast<int64_t>())
+                    .cast<uint64_t>() +
+            Eigen::Matrix<uint64_t, 3, 1>::Ones();
+    if (double(range(0)) * double(range(1)) * double(range(2)) <
+        std::pow(2.0, 63)) {
+        // Radix sorts the linear voxel indices, in a few passes.
+        std::vector<uint64_t> keys(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Matrix<uint64_t, 3, 1> key =
+                    (voxel_indices[i].cast<int64_t>() -
+                     min_index.cast<int64_t>())
+                            .cast<uint64_t>();
+            keys[i] = (key(0) * range(1) + key(1)) * range(2) + key(2);
+        }
+        utility::RadixSortKeys(keys, range.prod() - 1, order);
+    } else {
+        // Voxel indices too spread out for 64-bit keys.
+        order.resize(num_points);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            const Eigen::Vector3i &va = voxel_indices[a];
+            const Eigen::Vector3i &vb = voxel_indices[b];
+            return std::lexicographical_compare(va.data(), va.data() + 3,
+                                                vb.data(), vb.data() + 3);
+        });
+    }
+    voxel_offsets.clear();
+    for (int j = 0; j < num_points; j++) {
+        if (j == 0 || voxel_indices[order[j]] != voxel_indices[order[j - 1]]) {
+            voxel_offsets.push_back(j);
+        }
+    }
+    voxel_offsets.push_back(num_points);
+}
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -311,27 +379,35 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<int> order;
+    std::vector<int> voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, order,
+                       voxel_offsets);
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
+    const int num_voxels = int(voxel_offsets.size()) - 1;
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < num_voxels; v++) {
+        AccumulatedPoint accpoint;
+        for (int j = voxel_offsets[v]; j < voxel_offsets[v + 1]; j++) {
+            accpoint.AddPoint(*this, order[j]);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] = accpoint.GetAverageColor();
         }
     }
     utility::LogDebug(
@@ -360,51 +436,59 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    std::vector<int> order;
+    std::vector<int> voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, order,
+                       voxel_offsets);
+
+    const int num_voxels = int(voxel_offsets.size()) - 1;
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < num_voxels; v++) {
+        AccumulatedPointForTrace accpoint;
+        for (int j = voxel_offsets[v]; j < voxel_offsets[v + 1]; j++) {
+            size_t i = size_t(order[j]);
+            auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - floor(ref_coord(c))) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            accpoint.AddPoint(*this, i, cid, approximate_class);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                output->colors_[v] = accpoint.GetMaxClass();
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[v] = accpoint.GetAverageColor();
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+        auto original_id = accpoint.GetOriginalID();
+        for (int k = 0; k < (int)original_id.size(); k++) {
+            size_t pid = original_id[k].point_id;
+            int cid = original_id[k].cubic_id;
+            cubic_id(v, cid) = int(pid);
+            original_indices[v].push_back(int(pid));
         }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -443,25 +527,136 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
     return SelectByIndex(bbox.GetPointIndicesWithinBoundingBox(points_));
 }
 
+namespace {
+
+/// Number of points searched per batch by the outlier removals, bounding the
+/// memory of the neighbor lists.
+static constexpr size_t OUTLIER_SEARCH_BLOCK_SIZE = 1 << 16;
+
+/// Searches the neighbors of all points in batches, and calls
+/// func(i, distance2_begin, distance2_end) in parallel for every point i.
+/// Returns false if a search fails.
+template <typename Func>
+bool ForEachNeighborhood(const std::vector<Eigen::Vector3d> &points,
+                         const KDTreeFlann &kdtree,
+                         const KDTreeSearchParam &search_param,
+                         Func func) {
+    std::vector<Eigen::Vector3d> block;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<size_t> offsets;
+    for (size_t begin = 0; begin < points.size();
+         begin += OUTLIER_SEARCH_BLOCK_SIZE) {
+        size_t end = std::min(begin + OUTLIER_SEARCH_BLOCK_SIZE, points.size());
+        block.assign(points.begin() + begin, points.begin() + end);
+        if (!kdtree.SearchBatch(block, search_param, indices, distance2,
+                                offsets)) {
+            return false;
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(end - begin); i++) {
+            func(begin + i, distance2.begin() + offsets[i],
+                 distance2.begin() + offsets[i + 1]);
+        }
+    }
+    return true;
+}
+
+/// Returns the mean of the square roots of the squared distances in
+/// [begin, end), or -1 for an empty neighborhood.
+double MeanNeighborDistance(std::vector<double>::const_iterator begin,
+                            std::vector<double>::const_iterator end) {
+    if (end == begin) {
+        return -1.0;
+    }
+    double mean = 0.0;
+    for (auto dist2 = begin; dist2 != end; ++dist2) {
+        mean += std::sqrt(*dist2);
+    }
+    return mean / double(end - begin);
+}
+
+/// Returns the indices of the points whose average neighbor distance is below
+/// the mean plus std_ratio standard deviations of all the averages.
+std::vector<size_t> SelectStatisticalInliers(
+        const std::vector<double> &avg_distances, double std_ratio) {
+    std::vector<size_t> indices;
+    int64_t valid_distances = 0;
+    double cloud_mean = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : valid_distances, cloud_mean)
+#endif
+    for (int64_t i = 0; i < int64_t(avg_distances.size()); i++) {
+        if (avg_distances[i] > 0) {
+            valid_distances++;
+            cloud_mean += avg_distances[i];
+        }
+    }
+    if (valid_distances == 0) {
+        return indices;
+    }
+    cloud_mean /= valid_distances;
+    double sq_sum = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : sq_sum)
+#endif
+    for (int64_t i = 0; i < int64_t(avg_distances.size()); i++) {
+        if (avg_distances[i] > 0) {
+            sq_sum += (avg_distances[i] - cloud_mean) *
+                      (avg_distances[i] - cloud_mean);
+        }
+    }
+    // Bessel's correction
+    double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
+    double distance_threshold = cloud_mean + std_ratio * std_dev;
+    for (size_t i = 0; i < avg_distances.size(); i++) {
+        if (avg_distances[i] > 0 && avg_distances[i] < distance_threshold) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+}  // unnamed namespace
+
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
 PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(*this);
+    return RemoveRadiusOutliers(nb_points, search_radius, kdtree);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliers(size_t nb_points,
+                                 double search_radius,
+                                 const KDTreeFlann &kdtree) const {
     if (nb_points < 1 || search_radius <= 0) {
         utility::LogError(
                 "[RemoveRadiusOutliers] Illegal input parameters,"
                 "number of points and radius must be positive");
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
+    if (kdtree.GetDataSize() != points_.size()) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] kdtree is not built on this point "
+                "cloud.");
+    }
+    if (points_.size() <= nb_points) {
+        return std::make_tuple(std::make_shared<PointCloud>(),
+                               std::vector<size_t>());
+    }
+    // Only whether there are more than nb_points neighbors matters, so the
+    // search stops at nb_points + 1.
+    std::vector<uint8_t> mask(points_.size());
+    if (!ForEachNeighborhood(
+                points_, kdtree,
+                KDTreeSearchParamHybrid(search_radius, int(nb_points + 1)),
+                [&](size_t i, std::vector<double>::const_iterator begin,
+                    std::vector<double>::const_iterator end) {
+                    mask[i] = size_t(end - begin) > nb_points;
+                })) {
+        utility::LogError("[RemoveRadiusOutliers] KDTree search failed.");
     }
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
@@ -475,58 +670,68 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
 PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
                                       double std_ratio) const {
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(*this);
+    return RemoveStatisticalOutliers(nb_neighbors, std_ratio, kdtree);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
+                                      double std_ratio,
+                                      const KDTreeFlann &kdtree) const {
     if (nb_neighbors < 1 || std_ratio <= 0) {
         utility::LogError(
                 "[RemoveStatisticalOutliers] Illegal input parameters, number "
                 "of neighbors and standard deviation ratio must be positive");
     }
+    if (kdtree.GetDataSize() != points_.size()) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] kdtree is not built on this point "
+                "cloud.");
+    }
     if (points_.size() == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<double> avg_distances = std::vector<double>(points_.size());
-    std::vector<size_t> indices;
-    size_t valid_distances = 0;
+    std::vector<double> avg_distances(points_.size());
+    if (!ForEachNeighborhood(
+                points_, kdtree, KDTreeSearchParamKNN(int(nb_neighbors)),
+                [&](size_t i, std::vector<double>::const_iterator begin,
+                    std::vector<double>::const_iterator end) {
+                    avg_distances[i] = MeanNeighborDistance(begin, end);
+                })) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] KDTree search failed.");
+    }
+    std::vector<size_t> indices =
+            SelectStatisticalInliers(avg_distances, std_ratio);
+    return std::make_tuple(SelectByIndex(indices), indices);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveStatisticalOutliers(const NeighborGraph &graph,
+                                      double std_ratio) const {
+    if (std_ratio <= 0) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] Illegal input parameters, "
+                "standard deviation ratio must be positive");
+    }
+    if (graph.GetNodeCount() != points_.size()) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] graph is not built on this point "
+                "cloud.");
+    }
+    std::vector<double> avg_distances(points_.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
-        double mean = -1.0;
-        if (dist.size() > 0u) {
-            valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
-        }
-        avg_distances[i] = mean;
-    }
-    if (valid_distances == 0) {
-        return std::make_tuple(std::make_shared<PointCloud>(),
-                               std::vector<size_t>());
-    }
-    double cloud_mean = std::accumulate(
-            avg_distances.begin(), avg_distances.end(), 0.0,
-            [](double const &x, double const &y) { return y > 0 ? x + y : x; });
-    cloud_mean /= valid_distances;
-    double sq_sum = std::inner_product(
-            avg_distances.begin(), avg_distances.end(), avg_distances.begin(),
-            0.0, [](double const &x, double const &y) { return x + y; },
-            [cloud_mean](double const &x, double const &y) {
-                return x > 0 ? (x - cloud_mean) * (y - cloud_mean) : 0;
-            });
-    // Bessel's correction
-    double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
-    double distance_threshold = cloud_mean + std_ratio * std_dev;
-    for (size_t i = 0; i < avg_distances.size(); i++) {
-        if (avg_distances[i] > 0 && avg_distances[i] < distance_threshold) {
-            indices.push_back(i);
-        }
+    for (int i = 0; i < (int)points_.size(); i++) {
+        avg_distances[i] = MeanNeighborDistance(
+                graph.distance2_.begin() + graph.offsets_[i],
+                graph.distance2_.begin() + graph.offsets_[i + 1]);
     }
+    std::vector<size_t> indices =
+            SelectStatisticalInliers(avg_distances, std_ratio);
     return std::make_tuple(SelectByIndex(indices), indices);
 }
 
@@ -604,6 +809,30 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
     return nn_dis;
 }
 
+std::vector<double> PointCloud::ComputeNearestNeighborDistance(
+        const NeighborGraph &graph) const {
+    if (graph.GetNodeCount() != points_.size()) {
+        utility::LogError(
+                "[ComputeNearestNeighborDistance] graph is not built on this "
+                "point cloud.");
+    }
+    std::vector<double> nn_dis(points_.size(), 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)points_.size(); i++) {
+        // Neighbors are sorted by distance, the first one other than the point
+        // itself is the nearest.
+        for (size_t k = graph.offsets_[i]; k < graph.offsets_[i + 1]; k++) {
+            if (graph.indices_[k] != i) {
+                nn_dis[i] = std::sqrt(graph.distance2_[k]);
+                break;
+            }
+        }
+    }
+    return nn_dis;
+}
+
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 PointCloud::ComputeConvexHull() const {
     return Qhull::ComputeConvexHull(points_);
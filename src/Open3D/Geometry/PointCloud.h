@@ -43,6 +43,8 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class KDTreeFlann;
+class NeighborGraph;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -131,7 +133,8 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// Normals and colors are averaged if they exist. The output points are
+    /// ordered by voxel index.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
@@ -187,6 +190,17 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
 
+    /// \brief Function to remove points that have less than \p nb_points in a
+    /// sphere of a given radius, reusing a KDTree built on this point cloud.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \param kdtree KDTree built on this point cloud.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveRadiusOutliers(size_t nb_points,
+                         double search_radius,
+                         const KDTreeFlann &kdtree) const;
+
     /// \brief Function to remove points that are further away from their
     /// \p nb_neighbor neighbors in average.
     ///
@@ -195,6 +209,30 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveStatisticalOutliers(size_t nb_neighbors, double std_ratio) const;
 
+    /// \brief Function to remove points that are further away from their
+    /// \p nb_neighbor neighbors in average, reusing a KDTree built on this
+    /// point cloud.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point.
+    /// \param std_ratio Standard deviation ratio.
+    /// \param kdtree KDTree built on this point cloud.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveStatisticalOutliers(size_t nb_neighbors,
+                              double std_ratio,
+                              const KDTreeFlann &kdtree) const;
+
+    /// \brief Function to remove points that are further away from their
+    /// neighbors in average, reusing a neighbor graph of this point cloud.
+    ///
+    /// A KNN graph of nb_neighbors neighbors gives the same result as
+    /// RemoveStatisticalOutliers(nb_neighbors, std_ratio).
+    ///
+    /// \param graph Neighbor graph of this point cloud.
+    /// \param std_ratio Standard deviation ratio.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveStatisticalOutliers(const NeighborGraph &graph,
+                              double std_ratio) const;
+
     /// \brief Function to compute the normals of a point cloud.
     ///
     /// Normals are oriented with respect to the input point cloud if normals
@@ -208,6 +246,29 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of a point cloud, reusing a
+    /// KDTree built on this point cloud.
+    ///
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    /// \param fast_normal_computation If true, the normal estiamtion uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix.
+    /// \param kdtree KDTree built on this point cloud.
+    bool EstimateNormals(const KDTreeSearchParam &search_param,
+                         bool fast_normal_computation,
+                         const KDTreeFlann &kdtree);
+
+    /// \brief Function to compute the normals of a point cloud from the
+    /// neighborhoods of a neighbor graph of this point cloud.
+    ///
+    /// \param graph Neighbor graph of this point cloud.
+    /// \param fast_normal_computation If true, the normal estiamtion uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix.
+    bool EstimateNormals(const NeighborGraph &graph,
+                         bool fast_normal_computation = true);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -247,6 +308,12 @@ public:
     /// the input point cloud
     std::vector<double> ComputeNearestNeighborDistance() const;
 
+    /// Function to compute the distance from a point to its nearest neighbor,
+    /// reusing a neighbor graph of this point cloud. Points without any other
+    /// neighbor in the graph get a distance of 0.
+    std::vector<double> ComputeNearestNeighborDistance(
+            const NeighborGraph &graph) const;
+
     /// Function that computes the convex hull of the point cloud using qhull
     std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
     ComputeConvexHull() const;
@@ -269,9 +336,12 @@ public:
     /// in Large Spatial Databases with Noise", 1996
     ///
     /// Returns a list of point labels, -1 indicates noise according to
-    /// the algorithm.
+    /// the algorithm. Clusters are numbered by their smallest core point
+    /// index, and a border point joins the smallest-labeled cluster among its
+    /// core neighbors, so the labels do not depend on the number of threads.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
+    /// All points are noise if it is not positive.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
@@ -279,19 +349,63 @@ public:
                                    size_t min_points,
                                    bool print_progress = false) const;
 
+    /// \brief Cluster PointCloud using the DBSCAN algorithm, reusing a
+    /// radius neighbor graph of this point cloud.
+    ///
+    /// The radius of the graph is the eps density parameter. Hybrid graphs
+    /// are accepted, but truncating the neighborhoods to max_nn points
+    /// changes the clusters.
+    ///
+    /// \param graph Radius or hybrid neighbor graph of this point cloud.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \param print_progress If `true` the progress is visualized in the
+    /// console.
+    std::vector<int> ClusterDBSCAN(const NeighborGraph &graph,
+                                   size_t min_points,
+                                   bool print_progress = false) const;
+
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// The iterations run in parallel and stop early once the best plane has
+    /// been found with the given probability.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// Set to 1 to always run num_iterations iterations.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment several PointCloud planes one after the other using the
+    /// RANSAC algorithm, each plane among the points not in the previous
+    /// ones.
+    ///
+    /// \param max_planes Maximum number of planes to segment.
+    /// \param min_num_inliers Segmentation stops at the first plane with
+    /// fewer inliers.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Returns the plane models and the indices of their inliers, in
+    /// order of segmentation.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const int max_planes,
+                  const size_t min_num_inliers,
+                  const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
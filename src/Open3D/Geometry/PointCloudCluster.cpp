@@ -26,95 +26,233 @@
 
 #include "Open3D/Geometry/PointCloud.h"
 
-#include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/VoxelHashNeighborSearch.h"
 #include "Open3D/Utility/Console.h"
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
+namespace {
+
+/// Concurrent union-find whose roots are the smallest index of their set, so
+/// that the final sets and roots do not depend on the order of the unions.
+class ConcurrentUnionFind {
+public:
+    ConcurrentUnionFind(int size) : parent_(size) {
+        for (int i = 0; i < size; i++) {
+            parent_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int i) {
+        int parent = parent_[i].load(std::memory_order_relaxed);
+        while (parent != i) {
+            // Path halving, a lost race only leaves a longer path.
+            int grandparent = parent_[parent].load(std::memory_order_relaxed);
+            parent_[i].compare_exchange_weak(parent, grandparent,
+                                             std::memory_order_relaxed);
+            i = grandparent;
+            parent = parent_[i].load(std::memory_order_relaxed);
+        }
+        return i;
+    }
+
+    void Union(int i, int j) {
+        while (true) {
+            i = Find(i);
+            j = Find(j);
+            if (i == j) {
+                return;
+            }
+            if (i > j) {
+                std::swap(i, j);
+            }
+            // Links the larger root under the smaller one, retries if j
+            // stopped being a root meanwhile.
+            int expected = j;
+            if (parent_[j].compare_exchange_strong(expected, i)) {
+                return;
+            }
+        }
+    }
 
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+/// Runs DBSCAN on num_points points, where neighbors(idx, indices, dists2)
+/// returns the range of the eps-neighbors of point idx, itself included,
+/// possibly stored in the per-thread buffers indices and dists2.
+template <typename NeighborFunc>
+std::vector<int> ClusterDBSCANWithNeighbors(int num_points,
+                                            size_t min_points,
+                                            bool print_progress,
+                                            NeighborFunc neighbors) {
+    utility::LogDebug("Find Core Points");
+    utility::ConsoleProgressBar progress_bar(num_points, "Find Core Points",
+                                             print_progress);
+    std::vector<uint8_t> is_core(num_points, 0);
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel
 #endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
+    {
+        std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int idx = 0; idx < num_points; ++idx) {
+            auto range = neighbors(idx, indices, dists2);
+            is_core[idx] = size_t(range.second - range.first) >= min_points;
+            if (print_progress) {
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-        { ++progress_bar; }
+                { ++progress_bar; }
+            }
+        }
     }
-    utility::LogDebug("Done Precompute Neighbours");
+    utility::LogDebug("Done Find Core Points");
 
-    // set all labels to undefined (-2)
+    // Merges the neighboring core points. Each set is rooted at its smallest
+    // core point, so the clusters are numbered by their smallest core point.
     utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
+    progress_bar.reset(num_points, "Clustering", print_progress);
+    ConcurrentUnionFind sets(num_points);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int idx = 0; idx < num_points; ++idx) {
+            if (is_core[idx]) {
+                auto range = neighbors(idx, indices, dists2);
+                for (const int *nb = range.first; nb != range.second; ++nb) {
+                    if (*nb > idx && is_core[*nb]) {
+                        sets.Union(idx, *nb);
+                    }
+                }
+            }
+            if (print_progress) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                { ++progress_bar; }
+            }
         }
-
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    }
+    std::vector<int> labels(num_points, -1);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            int root = sets.Find(idx);
+            labels[idx] = root == idx ? cluster_label++ : labels[root];
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            if (labels[nb] != -2) {  // not undefined label
+    // A border point joins the cluster with the smallest label among its
+    // core neighbors, or stays noise.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int idx = 0; idx < num_points; ++idx) {
+            if (is_core[idx]) {
                 continue;
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
-
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
-                    }
+            auto range = neighbors(idx, indices, dists2);
+            int label = std::numeric_limits<int>::max();
+            for (const int *nb = range.first; nb != range.second; ++nb) {
+                if (is_core[*nb]) {
+                    label = std::min(label, labels[*nb]);
                 }
             }
+            if (label != std::numeric_limits<int>::max()) {
+                labels[idx] = label;
+            }
         }
-
-        cluster_label++;
     }
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
     return labels;
 }
 
+}  // unnamed namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    const int num_points = int(points_.size());
+    if (num_points == 0) {
+        return std::vector<int>();
+    }
+    // No point has a neighbor closer than a non-positive eps.
+    if (!(eps > 0.0)) {
+        return std::vector<int>(num_points, -1);
+    }
+    // Neighbors are streamed from a hash grid rather than stored, and
+    // queried again in each pass. The grid cannot index an eps that is tiny
+    // next to the coordinates, which falls back to a KDTree.
+    if (!VoxelHashNeighborSearch::CanIndex(points_, eps)) {
+        KDTreeFlann kdtree(*this);
+        return ClusterDBSCANWithNeighbors(
+                num_points, min_points, print_progress,
+                [&](int idx, std::vector<int> &indices,
+                    std::vector<double> &dists2) {
+                    kdtree.SearchRadius(points_[idx], eps, indices, dists2);
+                    return std::make_pair(indices.data(),
+                                          indices.data() + indices.size());
+                });
+    }
+    VoxelHashNeighborSearch grid(points_, eps);
+    return ClusterDBSCANWithNeighbors(
+            num_points, min_points, print_progress,
+            [&](int idx, std::vector<int> &indices,
+                std::vector<double> &dists2) {
+                grid.SearchRadius(points_[idx], eps, indices, dists2);
+                return std::make_pair(indices.data(),
+                                      indices.data() + indices.size());
+            });
+}
+
+std::vector<int> PointCloud::ClusterDBSCAN(const NeighborGraph &graph,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    if (points_.empty()) {
+        return std::vector<int>();
+    }
+    if (graph.GetNodeCount() != points_.size()) {
+        utility::LogError(
+                "[ClusterDBSCAN] graph is not built on this point cloud.");
+    }
+    if (graph.GetSearchType() == KDTreeSearchParam::SearchType::Knn) {
+        utility::LogError(
+                "[ClusterDBSCAN] graph must be a radius or hybrid graph.");
+    }
+    return ClusterDBSCANWithNeighbors(
+            int(points_.size()), min_points, print_progress,
+            [&](int idx, std::vector<int> &, std::vector<double> &) {
+                const int *begin = graph.indices_.data() + graph.offsets_[idx];
+                return std::make_pair(begin,
+                                      begin + graph.GetNeighborCount(idx));
+            });
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <numeric>
 #include <random>
@@ -36,6 +37,10 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace geometry {
 
@@ -52,34 +57,33 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
+// Calculates the number of inliers among the candidate points given a plane
+// model, and the total distance between the inliers and the plane. These
+// numbers are then used to evaluate how well the plane model fits the given
+// points.
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        double distance_threshold) {
     RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
+    double error = 0;
+    size_t inlier_num = 0;
+    for (size_t idx : candidates) {
+        double distance =
+                std::abs(plane_model.head<3>().dot(points[idx]) +
+                         plane_model(3));
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            inlier_num++;
         }
     }
 
-    size_t inlier_num = inliers.size();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
     } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+        result.fitness_ = (double)inlier_num / (double)candidates.size();
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
@@ -133,87 +137,232 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+namespace {
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
+/// Hypotheses are first scored on this many random points when there are
+/// many more candidate points.
+static constexpr size_t PREEMPTIVE_SUBSET_SIZE = 1024;
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+/// Number of RANSAC iterations after which a sample of ransac_n inliers has
+/// been drawn with the given probability, capped by max_iterations.
+int GetRANSACIterations(double inlier_ratio,
+                        int ransac_n,
+                        double probability,
+                        int max_iterations) {
+    const double sample_inlier_probability = std::pow(inlier_ratio, ransac_n);
+    if (sample_inlier_probability >= 1.0) {
+        return 1;
+    }
+    if (sample_inlier_probability <= 0.0) {
+        return max_iterations;
+    }
+    const double iterations = std::log(1.0 - probability) /
+                              std::log(1.0 - sample_inlier_probability);
+    return int(std::min(double(max_iterations), std::ceil(iterations)));
+}
 
+/// Parallel RANSAC plane fitting to the candidate points. The iterations are
+/// shared by the threads, each drawing from its own random stream, and stop
+/// early once the best plane so far has been sampled with the given
+/// probability. Returns the refined plane and its inliers among the
+/// candidates.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability) {
+    const size_t num_candidates = candidates.size();
     std::random_device rd;
     std::mt19937 rng(rd());
+    std::uniform_int_distribution<size_t> candidate_dist(0,
+                                                         num_candidates - 1);
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
+    // Random subset used to discard most hypotheses without scoring them
+    // against all the candidates.
+    std::vector<size_t> subset;
+    if (num_candidates > 4 * PREEMPTIVE_SUBSET_SIZE) {
+        subset.resize(PREEMPTIVE_SUBSET_SIZE);
+        for (size_t &idx : subset) {
+            idx = candidates[candidate_dist(rng)];
+        }
     }
+    const unsigned int seed = rng();
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+    RANSACResult result;
+    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+    std::atomic<int> max_iterations(num_iterations);
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
-        }
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        int thread_id = 0;
+#ifdef _OPENMP
+        thread_id = omp_get_thread_num();
+#endif
+        std::seed_seq thread_seed{seed, (unsigned int)thread_id};
+        std::mt19937 thread_rng(thread_seed);
+        std::uniform_int_distribution<size_t> thread_dist(0,
+                                                          num_candidates - 1);
+        std::vector<size_t> sample(ransac_n);
+        double best_fitness = 0;
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int itr = 0; itr < num_iterations; itr++) {
+            if (itr >= max_iterations.load()) {
+                continue;
+            }
+            for (int i = 0; i < ransac_n; ++i) {
+                do {
+                    sample[i] = candidates[thread_dist(thread_rng)];
+                } while (std::find(sample.begin(), sample.begin() + i,
+                                   sample[i]) != sample.begin() + i);
+            }
+
+            // Fit model to the randomly selected points.
+            Eigen::Vector4d plane_model =
+                    ransac_n == 3 ? TriangleMesh::ComputeTrianglePlane(
+                                            points[sample[0]],
+                                            points[sample[1]],
+                                            points[sample[2]])
+                                  : GetPlaneFromPoints(points, sample);
+            if (plane_model.isZero(0)) {
+                continue;
+            }
+
+            // Skips the plane if its inlier ratio on the subset is three
+            // standard deviations below the best one.
+            if (!subset.empty() && best_fitness > 0) {
+                double subset_inliers = 0;
+                for (size_t idx : subset) {
+                    subset_inliers +=
+                            std::abs(plane_model.head<3>().dot(points[idx]) +
+                                     plane_model(3)) < distance_threshold;
+                }
+                const double m = double(subset.size());
+                if (subset_inliers - best_fitness * m <
+                    -3.0 * std::sqrt(m * best_fitness * (1.0 - best_fitness))) {
+                    continue;
+                }
+            }
+
+            auto this_result = EvaluateRANSACBasedOnDistance(
+                    points, candidates, plane_model, distance_threshold);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            {
+                if (this_result.fitness_ > result.fitness_ ||
+                    (this_result.fitness_ == result.fitness_ &&
+                     this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                    result = this_result;
+                    best_plane_model = plane_model;
+                    max_iterations = std::min(
+                            max_iterations.load(),
+                            GetRANSACIterations(result.fitness_, ransac_n,
+                                                probability, num_iterations));
+                }
+                best_fitness = result.fitness_;
+            }
         }
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
-                              1);
-        double distance = std::abs(best_plane_model.dot(point));
-
+    std::vector<size_t> inliers;
+    for (size_t idx : candidates) {
+        double distance =
+                std::abs(best_plane_model.head<3>().dot(points[idx]) +
+                         best_plane_model(3));
         if (distance < distance_threshold) {
             inliers.emplace_back(idx);
         }
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iterations: "
+            "{:d}",
+            inliers.size(), result.fitness_, result.inlier_rmse_,
+            max_iterations.load());
     return std::make_tuple(best_plane_model, inliers);
 }
 
+}  // unnamed namespace
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    // Return if ransac_n is less than the required plane model parameters.
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (points_.size() < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be > 0 and <= 1.");
+    }
+
+    std::vector<size_t> candidates(points_.size());
+    std::iota(std::begin(candidates), std::end(candidates), 0);
+    return SegmentPlaneRANSAC(points_, candidates, distance_threshold,
+                              ransac_n, num_iterations, probability);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const int max_planes,
+                          const size_t min_num_inliers,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const double probability /* = 0.99999999 */) const {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be > 0 and <= 1.");
+    }
+
+    // The points left by the previous planes are tracked by index, the cloud
+    // itself is never copied.
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    while (int(planes.size()) < max_planes &&
+           remaining.size() >= size_t(ransac_n)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) =
+                SegmentPlaneRANSAC(points_, remaining, distance_threshold,
+                                   ransac_n, num_iterations, probability);
+        if (inliers.size() < std::max(min_num_inliers, size_t(1))) {
+            break;
+        }
+        // Both lists are sorted, removes the inliers in one pass.
+        size_t kept = 0;
+        auto inlier = inliers.begin();
+        for (size_t idx : remaining) {
+            if (inlier != inliers.end() && *inlier == idx) {
+                ++inlier;
+            } else {
+                remaining[kept++] = idx;
+            }
+        }
+        remaining.resize(kept);
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,435 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VoxelHashNeighborSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of queries handled by one task in SearchRadiusBatch.
+static constexpr int64_t SEARCH_BATCH_BLOCK_SIZE = 256;
+
+/// Number of cells handled by one task in SearchRadiusAll.
+static constexpr int64_t SEARCH_ALL_CELL_BLOCK_SIZE = 64;
+
+/// Computes the first cell and the number of cells of the grid covering the
+/// points. Returns false if the cell keys would not fit in 62 bits or the
+/// cells around the grid in int.
+bool ComputeGridBounds(const std::vector<Eigen::Vector3d> &points,
+                       double cell_size,
+                       Eigen::Vector3d &min_cell,
+                       Eigen::Vector3d &grid_size) {
+    Eigen::Vector3d min_bound = points[0];
+    Eigen::Vector3d max_bound = points[0];
+    for (const Eigen::Vector3d &point : points) {
+        min_bound = min_bound.cwiseMin(point);
+        max_bound = max_bound.cwiseMax(point);
+    }
+    min_cell = (min_bound / cell_size).array().floor();
+    const Eigen::Vector3d max_cell = (max_bound / cell_size).array().floor();
+    grid_size = max_cell - min_cell + Eigen::Vector3d::Ones();
+    const double int_max = double(std::numeric_limits<int>::max() / 2);
+    return grid_size.prod() < std::pow(2.0, 62) &&
+           min_cell.cwiseAbs().maxCoeff() <= int_max &&
+           max_cell.cwiseAbs().maxCoeff() <= int_max;
+}
+
+}  // unnamed namespace
+
+VoxelHashNeighborSearch::VoxelHashNeighborSearch(double cell_size)
+    : cell_size_(cell_size),
+      min_cell_(Eigen::Vector3i::Zero()),
+      grid_size_(Eigen::Vector3i::Zero()) {
+    if (cell_size <= 0.0) {
+        utility::LogError(
+                "[VoxelHashNeighborSearch] cell_size must be positive.");
+    }
+}
+
+VoxelHashNeighborSearch::VoxelHashNeighborSearch(
+        const std::vector<Eigen::Vector3d> &points, double cell_size)
+    : VoxelHashNeighborSearch(cell_size) {
+    SetPoints(points);
+}
+
+VoxelHashNeighborSearch::~VoxelHashNeighborSearch() {}
+
+bool VoxelHashNeighborSearch::CanIndex(
+        const std::vector<Eigen::Vector3d> &points, double cell_size) {
+    if (!(cell_size > 0.0) || points.empty() ||
+        points.size() > size_t(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    Eigen::Vector3d min_cell;
+    Eigen::Vector3d grid_size;
+    return ComputeGridBounds(points, cell_size, min_cell, grid_size);
+}
+
+Eigen::Vector3i VoxelHashNeighborSearch::GetCellIndex(
+        const Eigen::Vector3d &point, int rings) const {
+    Eigen::Vector3i cell;
+    for (int axis = 0; axis < 3; axis++) {
+        double index = std::floor(point(axis) / cell_size_) - min_cell_(axis);
+        // Cells further than rings from the grid have no neighbors anyway.
+        const double lower = -rings - 1.0;
+        const double upper = double(grid_size_(axis)) + rings;
+        if (!(index >= lower)) {
+            index = lower;
+        } else if (index > upper) {
+            index = upper;
+        }
+        cell(axis) = int(index);
+    }
+    return cell;
+}
+
+bool VoxelHashNeighborSearch::SetPoints(
+        const std::vector<Eigen::Vector3d> &points) {
+    points_.clear();
+    indices_.clear();
+    cell_z_.clear();
+    cell_offsets_.clear();
+    column_offsets_.clear();
+    column_map_.clear();
+    min_cell_.setZero();
+    grid_size_.setZero();
+    if (points.empty()) {
+        utility::LogWarning(
+                "[VoxelHashNeighborSearch::SetPoints] Failed due to no data.");
+        return false;
+    }
+    if (points.size() > size_t(std::numeric_limits<int>::max())) {
+        utility::LogWarning(
+                "[VoxelHashNeighborSearch::SetPoints] Too many points for int "
+                "indices.");
+        return false;
+    }
+    Eigen::Vector3d min_cell;
+    Eigen::Vector3d grid_size;
+    if (!ComputeGridBounds(points, cell_size_, min_cell, grid_size)) {
+        utility::LogError(
+                "[VoxelHashNeighborSearch::SetPoints] cell_size is too small.");
+    }
+    min_cell_ = min_cell.cast<int>();
+    grid_size_ = grid_size.cast<int>();
+
+    // Keys order the cells by (x, y, z), so that the cells of a column are
+    // contiguous.
+    const int num_points = int(points.size());
+    const uint64_t size_y = uint64_t(grid_size_(1));
+    const uint64_t size_z = uint64_t(grid_size_(2));
+    std::vector<uint64_t> keys(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        const Eigen::Vector3i cell = GetCellIndex(points[i], 0);
+        keys[i] = (uint64_t(cell(0)) * size_y + uint64_t(cell(1))) * size_z +
+                  uint64_t(cell(2));
+    }
+    std::vector<int> order;
+    utility::RadixSortKeys(keys, uint64_t(grid_size.prod() - 1.0), order);
+
+    points_.resize(num_points);
+    indices_ = order;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int j = 0; j < num_points; j++) {
+        points_[j] = points[order[j]];
+    }
+    for (int j = 0; j < num_points; j++) {
+        if (j > 0 && keys[j] == keys[j - 1]) {
+            continue;
+        }
+        const uint64_t column = keys[j] / size_z;
+        if (j == 0 || column != keys[j - 1] / size_z) {
+            column_map_[int64_t(column)] = int(column_offsets_.size());
+            column_offsets_.push_back(int(cell_z_.size()));
+        }
+        cell_z_.push_back(int(keys[j] % size_z));
+        cell_offsets_.push_back(j);
+    }
+    cell_offsets_.push_back(num_points);
+    column_offsets_.push_back(int(cell_z_.size()));
+    return true;
+}
+
+int VoxelHashNeighborSearch::GetRings(double radius) const {
+    if (!(radius > 0.0)) {
+        return -1;
+    }
+    // Scanning beyond the grid size finds nothing more.
+    const double max_rings = std::max(1, grid_size_.maxCoeff());
+    return int(std::max(1.0, std::min(std::ceil(radius / cell_size_),
+                                      max_rings)));
+}
+
+void VoxelHashNeighborSearch::GetNeighborRanges(
+        const Eigen::Vector3i &cell,
+        int rings,
+        std::vector<std::pair<int, int>> &ranges) const {
+    ranges.clear();
+    const int x_begin = std::max(cell(0) - rings, 0);
+    const int x_end = std::min(cell(0) + rings, grid_size_(0) - 1);
+    const int y_begin = std::max(cell(1) - rings, 0);
+    const int y_end = std::min(cell(1) + rings, grid_size_(1) - 1);
+    const int *cell_z = cell_z_.data();
+    for (int x = x_begin; x <= x_end; x++) {
+        for (int y = y_begin; y <= y_end; y++) {
+            auto found = column_map_.find(int64_t(x) * grid_size_(1) + y);
+            if (found == column_map_.end()) {
+                continue;
+            }
+            const int *column_begin = cell_z + column_offsets_[found->second];
+            const int *column_end =
+                    cell_z + column_offsets_[found->second + 1];
+            const int *first = std::lower_bound(column_begin, column_end,
+                                                cell(2) - rings);
+            const int *last =
+                    std::upper_bound(first, column_end, cell(2) + rings);
+            if (first == last) {
+                continue;
+            }
+            const int begin = cell_offsets_[first - cell_z];
+            const int end = cell_offsets_[last - cell_z];
+            if (!ranges.empty() && ranges.back().second == begin) {
+                ranges.back().second = end;
+            } else {
+                ranges.emplace_back(begin, end);
+            }
+        }
+    }
+}
+
+void VoxelHashNeighborSearch::ScanRanges(
+        const Eigen::Vector3d &query,
+        double radius2,
+        const std::vector<std::pair<int, int>> &ranges,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    for (const auto &range : ranges) {
+        for (int j = range.first; j < range.second; j++) {
+            double dist2 = (points_[j] - query).squaredNorm();
+            if (dist2 < radius2) {
+                indices.push_back(indices_[j]);
+                distance2.push_back(dist2);
+            }
+        }
+    }
+}
+
+int VoxelHashNeighborSearch::SearchRadius(
+        const Eigen::Vector3d &query,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    int rings = GetRings(radius);
+    if (points_.empty() || rings < 0) {
+        return -1;
+    }
+    std::vector<std::pair<int, int>> ranges;
+    GetNeighborRanges(GetCellIndex(query, rings), rings, ranges);
+    indices.clear();
+    distance2.clear();
+    ScanRanges(query, radius * radius, ranges, indices, distance2);
+    return int(indices.size());
+}
+
+int VoxelHashNeighborSearch::SearchHybrid(
+        const Eigen::Vector3d &query,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (max_nn < 0 || SearchRadius(query, radius, indices, distance2) < 0) {
+        return -1;
+    }
+    std::vector<std::pair<double, int>> neighbors(indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        neighbors[i] = std::make_pair(distance2[i], indices[i]);
+    }
+    if (neighbors.size() > size_t(max_nn)) {
+        std::nth_element(neighbors.begin(), neighbors.begin() + max_nn,
+                         neighbors.end());
+        neighbors.resize(max_nn);
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    indices.resize(neighbors.size());
+    distance2.resize(neighbors.size());
+    for (size_t i = 0; i < neighbors.size(); i++) {
+        distance2[i] = neighbors[i].first;
+        indices[i] = neighbors[i].second;
+    }
+    return int(indices.size());
+}
+
+bool VoxelHashNeighborSearch::SearchRadiusBatch(
+        const std::vector<Eigen::Vector3d> &queries,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    const int rings = GetRings(radius);
+    if (points_.empty() || rings < 0) {
+        return false;
+    }
+    const double radius2 = radius * radius;
+    const int64_t num_queries = int64_t(queries.size());
+    const int64_t num_blocks =
+            (num_queries + SEARCH_BATCH_BLOCK_SIZE - 1) /
+            SEARCH_BATCH_BLOCK_SIZE;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<double>> block_dists(num_blocks);
+    offsets.assign(num_queries + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int, int>> ranges;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t b = 0; b < num_blocks; b++) {
+            const int64_t begin = b * SEARCH_BATCH_BLOCK_SIZE;
+            const int64_t end =
+                    std::min(begin + SEARCH_BATCH_BLOCK_SIZE, num_queries);
+            for (int64_t i = begin; i < end; i++) {
+                GetNeighborRanges(GetCellIndex(queries[i], rings), rings,
+                                  ranges);
+                size_t count = block_indices[b].size();
+                ScanRanges(queries[i], radius2, ranges, block_indices[b],
+                           block_dists[b]);
+                // Counts for now, turned into offsets below.
+                offsets[i + 1] = block_indices[b].size() - count;
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < num_queries; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets.back());
+    distance2.resize(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t b = 0; b < num_blocks; b++) {
+        const size_t start = offsets[b * SEARCH_BATCH_BLOCK_SIZE];
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  indices.begin() + start);
+        std::copy(block_dists[b].begin(), block_dists[b].end(),
+                  distance2.begin() + start);
+    }
+    return true;
+}
+
+bool VoxelHashNeighborSearch::SearchRadiusAll(
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<size_t> &offsets) const {
+    const int rings = GetRings(radius);
+    if (points_.empty() || rings < 0) {
+        return false;
+    }
+    const double radius2 = radius * radius;
+    const int64_t num_points = int64_t(points_.size());
+    const int64_t num_cells = int64_t(cell_z_.size());
+    const int64_t num_blocks =
+            (num_cells + SEARCH_ALL_CELL_BLOCK_SIZE - 1) /
+            SEARCH_ALL_CELL_BLOCK_SIZE;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<double>> block_dists(num_blocks);
+    // Start of the neighbors of each sorted point in its block buffers.
+    std::vector<size_t> block_starts(num_points);
+    offsets.assign(num_points + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int, int>> ranges;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t b = 0; b < num_blocks; b++) {
+            const int64_t cell_begin = b * SEARCH_ALL_CELL_BLOCK_SIZE;
+            const int64_t cell_end = std::min(
+                    cell_begin + SEARCH_ALL_CELL_BLOCK_SIZE, num_cells);
+            for (int64_t c = cell_begin; c < cell_end; c++) {
+                GetNeighborRanges(
+                        GetCellIndex(points_[cell_offsets_[c]], rings), rings,
+                        ranges);
+                for (int j = cell_offsets_[c]; j < cell_offsets_[c + 1]; j++) {
+                    block_starts[j] = block_indices[b].size();
+                    ScanRanges(points_[j], radius2, ranges, block_indices[b],
+                               block_dists[b]);
+                    offsets[indices_[j] + 1] =
+                            block_indices[b].size() - block_starts[j];
+                }
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < num_points; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets.back());
+    distance2.resize(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t b = 0; b < num_blocks; b++) {
+        const int64_t cell_begin = b * SEARCH_ALL_CELL_BLOCK_SIZE;
+        const int64_t cell_end =
+                std::min(cell_begin + SEARCH_ALL_CELL_BLOCK_SIZE, num_cells);
+        for (int j = cell_offsets_[cell_begin]; j < cell_offsets_[cell_end];
+             j++) {
+            const int i = indices_[j];
+            const size_t count = offsets[i + 1] - offsets[i];
+            std::copy(block_indices[b].begin() + block_starts[j],
+                      block_indices[b].begin() + block_starts[j] + count,
+                      indices.begin() + offsets[i]);
+            std::copy(block_dists[b].begin() + block_starts[j],
+                      block_dists[b].begin() + block_starts[j] + count,
+                      distance2.begin() + offsets[i]);
+        }
+    }
+    return true;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class VoxelHashNeighborSearch
+///
+/// \brief Fixed-radius neighbor search on a spatial hash grid.
+///
+/// The points are binned into cubic cells whose size is the typical search
+/// radius, and radix sorted by cell so that every cell is a contiguous range
+/// and every column of cells along z is a contiguous run of cells. A radius
+/// query looks up the 9 columns around the query in a hash map and scans
+/// the 27 cells around it (more if the radius exceeds the cell size). The
+/// grid is built in linear time and, for data of roughly uniform density
+/// such as LiDAR scans, is much faster than a KDTree for fixed-radius
+/// queries.
+///
+/// Unlike KDTreeFlann, the radius searches return neighbors in storage
+/// order, not sorted by distance. Hybrid searches are sorted.
+class VoxelHashNeighborSearch {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cell_size Size of the grid cells, usually the search radius.
+    VoxelHashNeighborSearch(double cell_size);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param points Points to index.
+    /// \param cell_size Size of the grid cells, usually the search radius.
+    VoxelHashNeighborSearch(const std::vector<Eigen::Vector3d> &points,
+                            double cell_size);
+    ~VoxelHashNeighborSearch();
+
+public:
+    /// \brief Returns whether the points can be indexed with the given cell
+    /// size.
+    ///
+    /// The grid cannot be built for a non-positive cell size, or when the
+    /// cell size is so small relative to the extent or the magnitude of the
+    /// coordinates that the cell indices overflow, in which case SetPoints
+    /// throws.
+    static bool CanIndex(const std::vector<Eigen::Vector3d> &points,
+                         double cell_size);
+
+    /// Sets the indexed points, replacing the previous ones.
+    bool SetPoints(const std::vector<Eigen::Vector3d> &points);
+
+    /// Returns the size of the grid cells.
+    double GetCellSize() const { return cell_size_; }
+    /// Returns the number of indexed points.
+    size_t GetDataSize() const { return points_.size(); }
+    /// Returns the number of non-empty cells.
+    size_t GetCellCount() const { return cell_z_.size(); }
+
+    /// \brief Searches the points closer than radius to the query.
+    ///
+    /// \return The number of neighbors found, or -1 on invalid input.
+    int SearchRadius(const Eigen::Vector3d &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+    /// \brief Searches the max_nn points closest to the query within radius,
+    /// sorted by increasing distance.
+    ///
+    /// \return The number of neighbors found, or -1 on invalid input.
+    int SearchHybrid(const Eigen::Vector3d &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// \brief Radius search of many queries in parallel.
+    ///
+    /// Same CSR output layout as KDTreeFlann::SearchBatch: the neighbors of
+    /// query i are indices[offsets[i]:offsets[i + 1]].
+    bool SearchRadiusBatch(const std::vector<Eigen::Vector3d> &queries,
+                           double radius,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2,
+                           std::vector<size_t> &offsets) const;
+    /// \brief Radius search around every indexed point, each point being
+    /// among its own neighbors.
+    ///
+    /// The queries are processed cell by cell, so the neighbor cells are
+    /// looked up once per cell. Same output layout as SearchRadiusBatch, in
+    /// the order of the indexed points.
+    bool SearchRadiusAll(double radius,
+                         std::vector<int> &indices,
+                         std::vector<double> &distance2,
+                         std::vector<size_t> &offsets) const;
+
+private:
+    /// Returns the cell containing a point, relative to the first cell of
+    /// the grid and clamped to rings cells around the grid.
+    Eigen::Vector3i GetCellIndex(const Eigen::Vector3d &point,
+                                 int rings) const;
+    /// Collects the ranges [begin, end) of the sorted points in the
+    /// non-empty cells within rings cells of the given cell.
+    void GetNeighborRanges(const Eigen::Vector3i &cell,
+                           int rings,
+                           std::vector<std::pair<int, int>> &ranges) const;
+    /// Number of cell rings to scan for a radius, or -1 if invalid.
+    int GetRings(double radius) const;
+    /// Appends the neighbors of a query found in the given ranges.
+    void ScanRanges(const Eigen::Vector3d &query,
+                    double radius2,
+                    const std::vector<std::pair<int, int>> &ranges,
+                    std::vector<int> &indices,
+                    std::vector<double> &distance2) const;
+
+private:
+    double cell_size_;
+    /// First cell of the grid and number of cells along each axis.
+    Eigen::Vector3i min_cell_;
+    Eigen::Vector3i grid_size_;
+    /// Points sorted by cell, and their index in the input.
+    std::vector<Eigen::Vector3d> points_;
+    std::vector<int> indices_;
+    /// Non-empty cells sorted by (x, y, z). Cell c holds the sorted points
+    /// [cell_offsets_[c], cell_offsets_[c + 1]) and has z index cell_z_[c].
+    std::vector<int> cell_z_;
+    std::vector<int> cell_offsets_;
+    /// Column (x, y) holds the cells [column_offsets_[k],
+    /// column_offsets_[k + 1]) where k = column_map_[x * grid_size_(1) + y].
+    std::vector<int> column_offsets_;
+    std::unordered_map<int64_t, int> column_map_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -57,26 +57,39 @@ std::vector<std::pair<int, int>> AdvancedMatching(
     // STEP 1) Initial matching
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
+    geometry::KDTreeFlann feature_tree_i(features_vec[fi],
+                                         option.feature_index_param_);
+    geometry::KDTreeFlann feature_tree_j(features_vec[fj],
+                                         option.feature_index_param_);
     std::vector<int> corresK;
     std::vector<double> dis;
+    std::vector<size_t> offsets;
     std::vector<std::pair<int, int>> corres;
     std::vector<std::pair<int, int>> corres_ij;
     std::vector<std::pair<int, int>> corres_ji;
     std::vector<int> i_to_j(nPti, -1);
+    feature_tree_i.SearchKNNBatch(features_vec[fj].data_, 1, corresK, dis,
+                                  offsets);
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+        corres_ji.push_back(std::pair<int, int>(corresK[j], j));
+    }
+    // Reverse search only for the points of fi that were matched.
+    std::vector<int> matched_i;
+    std::vector<bool> is_matched(nPti, false);
+    for (int j = 0; j < nPtj; j++) {
+        if (!is_matched[corresK[j]]) {
+            is_matched[corresK[j]] = true;
+            matched_i.push_back(corresK[j]);
         }
-        corres_ji.push_back(std::pair<int, int>(i, j));
+    }
+    Eigen::MatrixXd matched_features(features_vec[fi].data_.rows(),
+                                     matched_i.size());
+    for (size_t k = 0; k < matched_i.size(); k++) {
+        matched_features.col(k) = features_vec[fi].data_.col(matched_i[k]);
+    }
+    feature_tree_j.SearchKNNBatch(matched_features, 1, corresK, dis, offsets);
+    for (size_t k = 0; k < matched_i.size(); k++) {
+        i_to_j[matched_i[k]] = corresK[k];
     }
     for (int i = 0; i < nPti; i++) {
         if (i_to_j[i] != -1)
@@ -31,6 +31,8 @@
 #include <tuple>
 #include <vector>
 
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -60,20 +62,25 @@ public:
     /// \param iteration_number Maximum number of iterations.
     /// \param tuple_scale Similarity measure used for tuples of feature points.
     /// \param maximum_tuple_count Maximum numer of tuples.
-    FastGlobalRegistrationOption(double division_factor = 1.4,
-                                 bool use_absolute_scale = false,
-                                 bool decrease_mu = true,
-                                 double maximum_correspondence_distance = 0.025,
-                                 int iteration_number = 64,
-                                 double tuple_scale = 0.95,
-                                 int maximum_tuple_count = 1000)
+    /// \param feature_index_param KDTree index used to match the features.
+    FastGlobalRegistrationOption(
+            double division_factor = 1.4,
+            bool use_absolute_scale = false,
+            bool decrease_mu = true,
+            double maximum_correspondence_distance = 0.025,
+            int iteration_number = 64,
+            double tuple_scale = 0.95,
+            int maximum_tuple_count = 1000,
+            const geometry::KDTreeIndexParam &feature_index_param =
+                    geometry::KDTreeIndexParam())
         : division_factor_(division_factor),
           use_absolute_scale_(use_absolute_scale),
           decrease_mu_(decrease_mu),
           maximum_correspondence_distance_(maximum_correspondence_distance),
           iteration_number_(iteration_number),
           tuple_scale_(tuple_scale),
-          maximum_tuple_count_(maximum_tuple_count) {}
+          maximum_tuple_count_(maximum_tuple_count),
+          feature_index_param_(feature_index_param) {}
     ~FastGlobalRegistrationOption() {}
 
 public:
@@ -94,6 +101,9 @@ public:
     double tuple_scale_;
     /// Maximum number of tuples..
     int maximum_tuple_count_;
+    /// KDTree index used to match the features. An approximate index speeds
+    /// up the matching of large feature sets.
+    geometry::KDTreeIndexParam feature_index_param_;
 };
 
 RegistrationResult FastGlobalRegistration(
@@ -29,6 +29,7 @@
 #include <Eigen/Dense>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 
@@ -71,10 +72,11 @@ Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
-std::shared_ptr<Feature> ComputeSPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+/// Computes the SPFH features, where search(i, indices, distance2) returns
+/// the neighbors of point i sorted by distance, the point itself first.
+template <typename SearchFunc>
+std::shared_ptr<Feature> ComputeSPFHFeature(const geometry::PointCloud &input,
+                                            SearchFunc search) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
 #ifdef _OPENMP
@@ -85,7 +87,7 @@ std::shared_ptr<Feature> ComputeSPFHFeature(
         const auto &normal = input.normals_[i];
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        if (search(i, indices, distance2) > 1) {
             // only compute SPFH feature when a point has neighbors
             double hist_incr = 100.0 / (double)(indices.size() - 1);
             for (size_t k = 1; k < indices.size(); k++) {
@@ -111,30 +113,21 @@ std::shared_ptr<Feature> ComputeSPFHFeature(
     return feature;
 }
 
-}  // unnamed namespace
-
-namespace registration {
-std::shared_ptr<Feature> ComputeFPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeSearchParam
-                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+/// Computes the FPFH features from the SPFH features of the neighbors, see
+/// ComputeSPFHFeature for search.
+template <typename SearchFunc>
+std::shared_ptr<Feature> ComputeFPFHFeatureWithSearch(
+        const geometry::PointCloud &input, SearchFunc search) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-    if (input.HasNormals() == false) {
-        utility::LogError(
-                "[ComputeFPFHFeature] Failed because input point cloud has no "
-                "normal.");
-    }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    auto spfh = ComputeSPFHFeature(input, search);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        if (search(i, indices, distance2) > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
             for (size_t k = 1; k < indices.size(); k++) {
                 // skip the point itself
@@ -162,5 +155,103 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     return feature;
 }
 
+}  // unnamed namespace
+
+namespace registration {
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    if (input.HasNormals() == false) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    geometry::KDTreeFlann kdtree(input);
+    return ComputeFPFHFeature(input, search_param, kdtree);
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param,
+        const geometry::KDTreeFlann &kdtree) {
+    if (input.HasNormals() == false) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    if (kdtree.GetDataSize() != input.points_.size()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] kdtree is not built on the input point "
+                "cloud.");
+    }
+    return ComputeFPFHFeatureWithSearch(
+            input, [&](int i, std::vector<int> &indices,
+                       std::vector<double> &distance2) {
+                return kdtree.Search(input.points_[i], search_param, indices,
+                                     distance2);
+            });
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborGraph &graph) {
+    if (input.HasNormals() == false) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    if (graph.GetNodeCount() != input.points_.size()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] graph is not built on the input point "
+                "cloud.");
+    }
+    return ComputeFPFHFeatureWithSearch(
+            input, [&](int i, std::vector<int> &indices,
+                       std::vector<double> &distance2) {
+                return graph.GetNeighbors(i, indices, distance2);
+            });
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter /* = false*/,
+        const geometry::KDTreeIndexParam &index_param
+        /* = geometry::KDTreeIndexParam()*/) {
+    CorrespondenceSet correspondences;
+    if (source_feature.Num() == 0 || target_feature.Num() == 0) {
+        return correspondences;
+    }
+    if (source_feature.Dimension() != target_feature.Dimension()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Feature dimensions {} and {} "
+                "do not match.",
+                source_feature.Dimension(), target_feature.Dimension());
+    }
+
+    std::vector<int> source_to_target;
+    std::vector<int> target_to_source;
+    std::vector<double> distance2;
+    std::vector<size_t> offsets;
+    geometry::KDTreeFlann target_kdtree(target_feature, index_param);
+    target_kdtree.SearchKNNBatch(source_feature.data_, 1, source_to_target,
+                                 distance2, offsets);
+    if (mutual_filter) {
+        geometry::KDTreeFlann source_kdtree(source_feature, index_param);
+        source_kdtree.SearchKNNBatch(target_feature.data_, 1,
+                                     target_to_source, distance2, offsets);
+    }
+
+    correspondences.reserve(source_to_target.size());
+    for (int i = 0; i < int(source_to_target.size()); i++) {
+        int j = source_to_target[i];
+        if (!mutual_filter || target_to_source[j] == i) {
+            correspondences.push_back(Eigen::Vector2i(i, j));
+        }
+    }
+    return correspondences;
+}
+
 }  // namespace registration
 }  // namespace open3d
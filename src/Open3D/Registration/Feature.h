@@ -31,12 +31,15 @@
 #include <vector>
 
 #include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Registration/TransformationEstimation.h"
 
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
+class NeighborGraph;
 class PointCloud;
-}
+}  // namespace geometry
 
 namespace registration {
 
@@ -72,5 +75,45 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud, reusing a KDTree built
+/// on the point cloud.
+///
+/// \param input The Input point cloud.
+/// \param search_param KDTree KNN search parameter.
+/// \param kdtree KDTree built on the input point cloud.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param,
+        const geometry::KDTreeFlann &kdtree);
+
+/// Function to compute FPFH feature for a point cloud from the neighborhoods
+/// of a neighbor graph of the point cloud.
+///
+/// \param input The Input point cloud.
+/// \param graph Neighbor graph of the input point cloud.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborGraph &graph);
+
+/// \brief Function to match features by nearest neighbor in feature space.
+///
+/// Every source feature is matched to its nearest target feature, with all
+/// queries searched in parallel batches.
+///
+/// \param source_feature Source features.
+/// \param target_feature Target features.
+/// \param mutual_filter If true, only keeps the pairs whose source feature
+/// is also the nearest neighbor of their target feature.
+/// \param index_param KDTree index used for the searches, an approximate
+/// index speeds up the matching of large feature sets.
+/// \return Correspondences (source index, target index), sorted by source
+/// index.
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter = false,
+        const geometry::KDTreeIndexParam &index_param =
+                geometry::KDTreeIndexParam());
+
 }  // namespace registration
 }  // namespace open3d
@@ -103,93 +103,122 @@ inline Eigen::Vector6d GetLinearized6DVector(const Eigen::Matrix4d &input) {
     return output;
 }
 
-inline Eigen::Vector6d GetMisalignmentVector(const Eigen::Matrix4d &X_inv,
-                                             const Eigen::Matrix4d &Ts,
-                                             const Eigen::Matrix4d &Tt_inv) {
+inline Eigen::Vector6d GetMisalignmentVector(
+        const Eigen::Matrix4d &X_inv_Tt_inv, const Eigen::Matrix4d &Ts) {
     Eigen::Matrix4d temp;
-    temp.noalias() = X_inv * Tt_inv * Ts;
+    temp.noalias() = X_inv_Tt_inv * Ts;
     return GetLinearized6DVector(temp);
 }
 
-inline std::tuple<Eigen::Matrix4d, Eigen::Matrix4d, Eigen::Matrix4d>
-GetRelativePoses(const PoseGraph &pose_graph, int edge_id) {
+/// Inverses of the edge transformations, which stay constant during an
+/// optimization.
+std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+ComputeTransformationInverses(const PoseGraph &pose_graph) {
+    int n_edges = (int)pose_graph.edges_.size();
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> output(n_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        output[iter_edge] =
+                pose_graph.edges_[iter_edge].transformation_.inverse();
+    }
+    return output;
+}
+
+/// Inverses of the node poses, computed once per update of the poses rather
+/// than once per edge.
+std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> ComputePoseInverses(
+        const std::vector<PoseGraphNode> &nodes) {
+    int n_nodes = (int)nodes.size();
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> output(n_nodes);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        output[iter_node] = nodes[iter_node].pose_.inverse();
+    }
+    return output;
+}
+
+/// Returns X^-1 * Tt^-1 and Ts of an edge from the cached inverses, with the
+/// poses of \p nodes.
+inline std::tuple<Eigen::Matrix4d, Eigen::Matrix4d> GetRelativePoses(
+        const PoseGraph &pose_graph,
+        const std::vector<PoseGraphNode> &nodes,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformation_inverses,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &pose_inverses,
+        int edge_id) {
     const PoseGraphEdge &te = pose_graph.edges_[edge_id];
-    const PoseGraphNode &ts = pose_graph.nodes_[te.source_node_id_];
-    const PoseGraphNode &tt = pose_graph.nodes_[te.target_node_id_];
-    Eigen::Matrix4d X_inv = te.transformation_.inverse();
-    Eigen::Matrix4d Ts = ts.pose_;
-    Eigen::Matrix4d Tt_inv = tt.pose_.inverse();
-    return std::make_tuple(std::move(X_inv), std::move(Ts), std::move(Tt_inv));
+    Eigen::Matrix4d X_inv_Tt_inv = transformation_inverses[edge_id] *
+                                   pose_inverses[te.target_node_id_];
+    Eigen::Matrix4d Ts = nodes[te.source_node_id_].pose_;
+    return std::make_tuple(std::move(X_inv_Tt_inv), std::move(Ts));
 }
 
+/// The operators of Jt are the opposite of the ones of Js, so Jt = -Js.
 std::tuple<Eigen::Matrix6d, Eigen::Matrix6d> GetJacobian(
-        const Eigen::Matrix4d &X_inv,
-        const Eigen::Matrix4d &Ts,
-        const Eigen::Matrix4d &Tt_inv) {
-    Eigen::Matrix6d Js = Eigen::Matrix6d::Zero();
+        const Eigen::Matrix4d &X_inv_Tt_inv, const Eigen::Matrix4d &Ts) {
+    Eigen::Matrix6d Js;
     for (int i = 0; i < 6; i++) {
-        Eigen::Matrix4d temp = X_inv * Tt_inv * jacobian_operator[i] * Ts;
+        Eigen::Matrix4d temp = X_inv_Tt_inv * jacobian_operator[i] * Ts;
         Js.block<6, 1>(0, i) = GetLinearized6DVector(temp);
     }
-    Eigen::Matrix6d Jt = Eigen::Matrix6d::Zero();
-    for (int i = 0; i < 6; i++) {
-        Eigen::Matrix4d temp = X_inv * Tt_inv * -jacobian_operator[i] * Ts;
-        Jt.block<6, 1>(0, i) = GetLinearized6DVector(temp);
-    }
+    Eigen::Matrix6d Jt = -Js;
     return std::make_tuple(std::move(Js), std::move(Jt));
 }
 
 /// Function to update line_process value defined in [Choi et al 2015]
 /// See Eq (2). temp2 value in this function is derived from dE/dl = 0
-int UpdateConfidence(PoseGraph &pose_graph,
-                     const Eigen::VectorXd &zeta,
-                     const double line_process_weight,
-                     const GlobalOptimizationOption &option) {
-    int n_edges = (int)pose_graph.edges_.size();
-    int valid_edges_num = 0;
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        if (t.uncertain_) {
-            Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
-            double residual_square = e.transpose() * t.information_ * e;
-            double temp = line_process_weight /
-                          (line_process_weight + residual_square);
-            double temp2 = temp * temp;
-            t.confidence_ = temp2;
-            if (temp2 > option.edge_prune_threshold_) valid_edges_num++;
-        }
+/// Returns true if the edge is uncertain and still valid.
+inline bool UpdateConfidence(PoseGraphEdge &t,
+                             const Eigen::Vector6d &e,
+                             const double line_process_weight,
+                             const GlobalOptimizationOption &option) {
+    if (!t.uncertain_) {
+        return false;
     }
-    return valid_edges_num;
+    double residual_square = e.transpose() * t.information_ * e;
+    double temp =
+            line_process_weight / (line_process_weight + residual_square);
+    double temp2 = temp * temp;
+    t.confidence_ = temp2;
+    return temp2 > option.edge_prune_threshold_;
 }
 
-/// Function to compute residual defined in [Choi et al 2015] See Eq (9).
-double ComputeResidual(const PoseGraph &pose_graph,
-                       const Eigen::VectorXd &zeta,
-                       const double line_process_weight,
-                       const GlobalOptimizationOption &option) {
+/// Function to compute residual defined in [Choi et al 2015] See Eq (6),
+/// along with the residual defined in Eq (9) in the same pass. The edges are
+/// processed in parallel and the residual is reduced over the threads. The
+/// edges of \p pose_graph are evaluated with the poses of \p nodes.
+std::tuple<Eigen::VectorXd, double> ComputeZetaAndResidual(
+        const PoseGraph &pose_graph,
+        const std::vector<PoseGraphNode> &nodes,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformation_inverses,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &pose_inverses,
+        const double line_process_weight) {
     int n_edges = (int)pose_graph.edges_.size();
+    Eigen::VectorXd zeta(n_edges * 6);
     double residual = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : residual)
+#endif
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &te = pose_graph.edges_[iter_edge];
+        Eigen::Matrix4d X_inv_Tt_inv, Ts;
+        std::tie(X_inv_Tt_inv, Ts) =
+                GetRelativePoses(pose_graph, nodes, transformation_inverses,
+                                 pose_inverses, iter_edge);
+        Eigen::Vector6d e = GetMisalignmentVector(X_inv_Tt_inv, Ts);
+        zeta.block<6, 1>(iter_edge * 6, 0) = e;
         double line_process_iter = te.confidence_;
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
         residual += line_process_iter * e.transpose() * te.information_ * e +
                     line_process_weight * pow(sqrt(line_process_iter) - 1, 2.0);
     }
-    return residual;
-}
-
-/// Function to compute residual defined in [Choi et al 2015] See Eq (6).
-Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
-    int n_edges = (int)pose_graph.edges_.size();
-    Eigen::VectorXd output(n_edges * 6);
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
-        Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
-        output.block<6, 1>(iter_edge * 6, 0) = e;
-    }
-    return output;
+    return std::make_tuple(std::move(zeta), residual);
 }
 
 /// The information matrix used here is consistent with [Choi et al 2015].
@@ -205,24 +234,53 @@ Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+///
+/// H is assembled directly as a sparse matrix of 6x6 blocks, one per node and
+/// per edge end. The edges fill their own slots of the triplet list in
+/// parallel, and every block and diagonal coefficient is stored even when
+/// zero, so that the sparsity pattern only depends on the edges.
+///
+/// The line processes of the uncertain edges are updated from zeta in the
+/// same pass, see UpdateConfidence, and the number of valid uncertain edges
+/// is returned along with H and b.
+std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd, int>
+UpdateConfidenceAndComputeLinearSystem(
+        PoseGraph &pose_graph,
+        const Eigen::VectorXd &zeta,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformation_inverses,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &pose_inverses,
+        const double line_process_weight,
+        const GlobalOptimizationOption &option) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
+    std::vector<Eigen::Triplet<double>> triplets(n_nodes * 6 +
+                                                 n_edges * 4 * 36);
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> b_edges(
+            n_edges * 2);
+    for (int i = 0; i < n_nodes * 6; i++) {
+        triplets[i] = Eigen::Triplet<double>(i, i, 0.0);
+    }
 
+    int valid_edges_num = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : valid_edges_num)
+#endif
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        if (UpdateConfidence(t, e, line_process_weight, option)) {
+            valid_edges_num++;
+        }
 
-        Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        Eigen::Matrix4d X_inv_Tt_inv, Ts;
+        std::tie(X_inv_Tt_inv, Ts) = GetRelativePoses(
+                pose_graph, pose_graph.nodes_, transformation_inverses,
+                pose_inverses, iter_edge);
 
         Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+        std::tie(Js, Jt) = GetJacobian(X_inv_Tt_inv, Ts);
         Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
         Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
         Eigen::Vector6d eT_Info = e.transpose() * t.information_;
@@ -230,22 +288,85 @@ std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
 
         int id_i = t.source_node_id_ * 6;
         int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        const Eigen::Matrix6d blocks[4] = {
+                line_process_iter * JsT_Info * Js,
+                line_process_iter * JsT_Info * Jt,
+                line_process_iter * JtT_Info * Js,
+                line_process_iter * JtT_Info * Jt};
+        const int rows[4] = {id_i, id_i, id_j, id_j};
+        const int cols[4] = {id_i, id_j, id_i, id_j};
+        Eigen::Triplet<double> *slot =
+                triplets.data() + n_nodes * 6 + iter_edge * 4 * 36;
+        for (int k = 0; k < 4; k++) {
+            for (int c = 0; c < 6; c++) {
+                for (int r = 0; r < 6; r++) {
+                    *slot++ = Eigen::Triplet<double>(rows[k] + r, cols[k] + c,
+                                                     blocks[k](r, c));
+                }
+            }
+        }
+        b_edges[iter_edge * 2] =
+                (line_process_iter * eT_Info.transpose() * Js).transpose();
+        b_edges[iter_edge * 2 + 1] =
+                (line_process_iter * eT_Info.transpose() * Jt).transpose();
     }
-    return std::make_tuple(std::move(H), std::move(b));
+
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::VectorXd b(n_nodes * 6);
+    b.setZero();
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        b.block<6, 1>(t.source_node_id_ * 6, 0) -= b_edges[iter_edge * 2];
+        b.block<6, 1>(t.target_node_id_ * 6, 0) -= b_edges[iter_edge * 2 + 1];
+    }
+    return std::make_tuple(std::move(H), std::move(b), valid_edges_num);
 }
 
+/// \class PoseGraphLinearSolver
+///
+/// Sparse Cholesky solver of the linear systems of a pose graph
+/// optimization. The sparsity pattern of H only depends on the edges, so its
+/// symbolic factorization is computed at the first solve and reused by the
+/// following ones, which only factorize numerically.
+class PoseGraphLinearSolver {
+public:
+    /// Solves (H + lambda * I) delta = b, returns false if the factorization
+    /// fails.
+    bool Solve(const Eigen::SparseMatrix<double> &H,
+               const Eigen::VectorXd &b,
+               double lambda,
+               Eigen::VectorXd &delta) {
+        const Eigen::SparseMatrix<double> *A = &H;
+        Eigen::SparseMatrix<double> H_LM;
+        if (lambda != 0.0) {
+            H_LM = H;
+            for (int i = 0; i < H_LM.rows(); i++) {
+                H_LM.coeffRef(i, i) += lambda;
+            }
+            A = &H_LM;
+        }
+        if (!analyzed_) {
+            solver_.analyzePattern(*A);
+            analyzed_ = true;
+        }
+        solver_.factorize(*A);
+        if (solver_.info() == Eigen::Success) {
+            delta = solver_.solve(b);
+            if (solver_.info() == Eigen::Success) {
+                return true;
+            }
+        }
+        utility::LogWarning("[GlobalOptimization] Cholesky solve failed.");
+        delta = Eigen::VectorXd::Zero(b.rows());
+        return false;
+    }
+
+private:
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+    bool analyzed_ = false;
+};
+
 Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -257,19 +378,22 @@ Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     return output;
 }
 
-std::shared_ptr<PoseGraph> UpdatePoseGraph(const PoseGraph &pose_graph,
-                                           const Eigen::VectorXd delta) {
-    std::shared_ptr<PoseGraph> pose_graph_updated =
-            std::make_shared<PoseGraph>();
-    *pose_graph_updated = pose_graph;
-    int n_nodes = (int)pose_graph.nodes_.size();
+/// Returns the nodes of \p pose_graph moved by \p delta. The edges do not
+/// change during an update, so they are not copied.
+std::vector<PoseGraphNode> UpdatePoseGraphNodes(const PoseGraph &pose_graph,
+                                                const Eigen::VectorXd &delta) {
+    std::vector<PoseGraphNode> nodes_updated = pose_graph.nodes_;
+    int n_nodes = (int)nodes_updated.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
         Eigen::Vector6d delta_iter = delta.block<6, 1>(iter_node * 6, 0);
-        pose_graph_updated->nodes_[iter_node].pose_ =
+        nodes_updated[iter_node].pose_ =
                 utility::TransformVector6dToMatrix4d(delta_iter) *
-                pose_graph_updated->nodes_[iter_node].pose_;
+                nodes_updated[iter_node].pose_;
     }
-    return pose_graph_updated;
+    return nodes_updated;
 }
 
 bool CheckRightTerm(const Eigen::VectorXd &right_term,
@@ -501,21 +625,24 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             n_nodes, n_edges);
     utility::LogDebug("Line process weight : {:f}", line_process_weight);
 
-    Eigen::VectorXd zeta = ComputeZeta(pose_graph);
+    auto transformation_inverses = ComputeTransformationInverses(pose_graph);
+    auto pose_inverses = ComputePoseInverses(pose_graph.nodes_);
+    Eigen::VectorXd zeta;
     double current_residual, new_residual;
-    new_residual =
-            ComputeResidual(pose_graph, zeta, line_process_weight, option);
+    std::tie(zeta, new_residual) = ComputeZetaAndResidual(
+            pose_graph, pose_graph.nodes_, transformation_inverses,
+            pose_inverses, line_process_weight);
     current_residual = new_residual;
 
     int valid_edges_num;
-    valid_edges_num =
-            UpdateConfidence(pose_graph, zeta, line_process_weight, option);
-
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+    PoseGraphLinearSolver solver;
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b, valid_edges_num) = UpdateConfidenceAndComputeLinearSystem(
+            pose_graph, zeta, transformation_inverses, pose_inverses,
+            line_process_weight, option);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -529,36 +656,36 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
+        // Solve H @ delta == b using a sparse solver
         Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        solver.Solve(H, b, 0.0, delta);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
             break;
         } else {
-            std::shared_ptr<PoseGraph> pose_graph_new =
-                    UpdatePoseGraph(pose_graph, delta);
+            std::vector<PoseGraphNode> nodes_new =
+                    UpdatePoseGraphNodes(pose_graph, delta);
 
             Eigen::VectorXd zeta_new;
-            zeta_new = ComputeZeta(*pose_graph_new);
-            new_residual = ComputeResidual(pose_graph, zeta_new,
-                                           line_process_weight, option);
+            auto pose_inverses_new = ComputePoseInverses(nodes_new);
+            std::tie(zeta_new, new_residual) = ComputeZetaAndResidual(
+                    pose_graph, nodes_new, transformation_inverses,
+                    pose_inverses_new, line_process_weight);
             stop = stop || CheckRelativeResidualIncrement(
                                    current_residual, new_residual, criteria);
             if (stop) break;
             current_residual = new_residual;
 
-            zeta = zeta_new;
-            pose_graph = *pose_graph_new;
+            // Only the poses changed, the edges are left in place.
+            zeta = std::move(zeta_new);
+            pose_graph.nodes_ = std::move(nodes_new);
+            pose_inverses = std::move(pose_inverses_new);
             x = UpdatePoseVector(pose_graph);
-            valid_edges_num = UpdateConfidence(pose_graph, zeta,
-                                               line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            std::tie(H, b, valid_edges_num) =
+                    UpdateConfidenceAndComputeLinearSystem(
+                            pose_graph, zeta, transformation_inverses,
+                            pose_inverses, line_process_weight, option);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -593,21 +720,24 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
             n_nodes, n_edges);
     utility::LogDebug("Line process weight : {:f}", line_process_weight);
 
-    Eigen::VectorXd zeta = ComputeZeta(pose_graph);
+    auto transformation_inverses = ComputeTransformationInverses(pose_graph);
+    auto pose_inverses = ComputePoseInverses(pose_graph.nodes_);
+    Eigen::VectorXd zeta;
     double current_residual, new_residual;
-    new_residual =
-            ComputeResidual(pose_graph, zeta, line_process_weight, option);
+    std::tie(zeta, new_residual) = ComputeZetaAndResidual(
+            pose_graph, pose_graph.nodes_, transformation_inverses,
+            pose_inverses, line_process_weight);
     current_residual = new_residual;
 
-    int valid_edges_num =
-            UpdateConfidence(pose_graph, zeta, line_process_weight, option);
-
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    int valid_edges_num;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+    PoseGraphLinearSolver solver;
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b, valid_edges_num) = UpdateConfidenceAndComputeLinearSystem(
+            pose_graph, zeta, transformation_inverses, pose_inverses,
+            line_process_weight, option);
 
     Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
@@ -629,24 +759,20 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
-
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            // Solve (H + lambda * I) @ delta == b using a sparse solver
+            Eigen::VectorXd delta(H.cols());
+            solver.Solve(H, b, current_lambda, delta);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
-                std::shared_ptr<PoseGraph> pose_graph_new =
-                        UpdatePoseGraph(pose_graph, delta);
+                std::vector<PoseGraphNode> nodes_new =
+                        UpdatePoseGraphNodes(pose_graph, delta);
 
                 Eigen::VectorXd zeta_new;
-                zeta_new = ComputeZeta(*pose_graph_new);
-                new_residual = ComputeResidual(pose_graph, zeta_new,
-                                               line_process_weight, option);
+                auto pose_inverses_new = ComputePoseInverses(nodes_new);
+                std::tie(zeta_new, new_residual) = ComputeZetaAndResidual(
+                        pose_graph, nodes_new, transformation_inverses,
+                        pose_inverses_new, line_process_weight);
                 rho = (current_residual - new_residual) /
                       (delta.dot(current_lambda * delta + b) + 1e-3);
                 if (rho > 0) {
@@ -662,12 +788,15 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     ni = 2;
                     current_residual = new_residual;
 
-                    zeta = zeta_new;
-                    pose_graph = *pose_graph_new;
+                    // Only the poses changed, the edges are left in place.
+                    zeta = std::move(zeta_new);
+                    pose_graph.nodes_ = std::move(nodes_new);
+                    pose_inverses = std::move(pose_inverses_new);
                     x = UpdatePoseVector(pose_graph);
-                    valid_edges_num = UpdateConfidence(
-                            pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    std::tie(H, b, valid_edges_num) =
+                            UpdateConfidenceAndComputeLinearSystem(
+                                    pose_graph, zeta, transformation_inverses,
+                                    pose_inverses, line_process_weight, option);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -26,7 +26,9 @@
 
 #include "Open3D/Registration/Registration.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <memory>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -39,61 +41,114 @@ namespace open3d {
 namespace {
 using namespace registration;
 
-RegistrationResult GetRegistrationResultAndCorrespondences(
+// Number of source points per block when the search results are compacted
+// into a correspondence set.
+static constexpr int CORRESPONDENCE_BLOCK_SIZE = 4096;
+
+// Buffers of the correspondence search. ICP keeps one across its iterations,
+// so that the buffers are not reallocated at every iteration.
+struct CorrespondenceBuffer {
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<size_t> offsets;
+    std::vector<int> block_offsets;
+    std::vector<double> block_error2;
+};
+
+// Updates result with the correspondences of source in target, and their
+// fitness and RMSE. The correspondence set of result is overwritten in place
+// and keeps its capacity.
+void UpdateRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const geometry::KDTreeFlann &target_kdtree,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
-    RegistrationResult result(transformation);
+        const Eigen::Matrix4d &transformation,
+        CorrespondenceBuffer &buffer,
+        RegistrationResult &result) {
+    result.transformation_ = transformation;
+    result.correspondence_set_.clear();
+    result.fitness_ = 0.0;
+    result.inlier_rmse_ = 0.0;
     if (max_correspondence_distance <= 0.0) {
-        return result;
+        return;
     }
 
-    double error2 = 0.0;
+    // At most one neighbor per source point, so offsets[i + 1] - offsets[i]
+    // tells whether point i found a correspondence.
+    if (!target_kdtree.SearchHybridBatch(
+                source.points_, max_correspondence_distance, 1,
+                buffer.indices, buffer.distance2, buffer.offsets)) {
+        return;
+    }
+    const std::vector<int> &indices = buffer.indices;
+    const std::vector<double> &dists = buffer.distance2;
+    const std::vector<size_t> &offsets = buffer.offsets;
 
+    // Each block of source points writes its correspondences to its own
+    // range of the correspondence set, given by the counts of the blocks
+    // before it, so that the set is filled in parallel and in order.
+    const int num_points = (int)source.points_.size();
+    const int num_blocks = (num_points + CORRESPONDENCE_BLOCK_SIZE - 1) /
+                           CORRESPONDENCE_BLOCK_SIZE;
+    buffer.block_offsets.assign(num_blocks + 1, 0);
+    buffer.block_error2.assign(num_blocks, 0.0);
 #ifdef _OPENMP
-#pragma omp parallel
-    {
+#pragma omp parallel for schedule(static)
 #endif
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
+    for (int b = 0; b < num_blocks; b++) {
+        const int end =
+                std::min(num_points, (b + 1) * CORRESPONDENCE_BLOCK_SIZE);
+        int count = 0;
+        double error2 = 0.0;
+        for (int i = b * CORRESPONDENCE_BLOCK_SIZE; i < end; i++) {
+            if (offsets[i + 1] > offsets[i]) {
+                count++;
+                error2 += dists[offsets[i]];
             }
         }
+        buffer.block_offsets[b + 1] = count;
+        buffer.block_error2[b] = error2;
+    }
+    double error2 = 0.0;
+    for (int b = 0; b < num_blocks; b++) {
+        buffer.block_offsets[b + 1] += buffer.block_offsets[b];
+        error2 += buffer.block_error2[b];
+    }
+    result.correspondence_set_.resize(buffer.block_offsets[num_blocks]);
 #ifdef _OPENMP
-#pragma omp critical
+#pragma omp parallel for schedule(static)
 #endif
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
+    for (int b = 0; b < num_blocks; b++) {
+        const int end =
+                std::min(num_points, (b + 1) * CORRESPONDENCE_BLOCK_SIZE);
+        int k = buffer.block_offsets[b];
+        for (int i = b * CORRESPONDENCE_BLOCK_SIZE; i < end; i++) {
+            if (offsets[i + 1] > offsets[i]) {
+                result.correspondence_set_[k++] =
+                        Eigen::Vector2i(i, indices[offsets[i]]);
             }
-            error2 += error2_private;
         }
-#ifdef _OPENMP
     }
-#endif
 
-    if (result.correspondence_set_.empty()) {
-        result.fitness_ = 0.0;
-        result.inlier_rmse_ = 0.0;
-    } else {
+    if (!result.correspondence_set_.empty()) {
         size_t corres_number = result.correspondence_set_.size();
         result.fitness_ = (double)corres_number / (double)source.points_.size();
         result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
     }
+}
+
+RegistrationResult GetRegistrationResultAndCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
+    RegistrationResult result(transformation);
+    CorrespondenceBuffer buffer;
+    UpdateRegistrationResultAndCorrespondences(
+            source, target, target_kdtree, max_correspondence_distance,
+            transformation, buffer, result);
     return result;
 }
 
@@ -126,6 +181,59 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+void CheckNormalsForEstimation(const geometry::PointCloud &source,
+                               const geometry::PointCloud &target,
+                               const TransformationEstimation &estimation) {
+    if ((estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::PointToPlane ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::ColoredICP) &&
+        (!source.HasNormals() || !target.HasNormals())) {
+        utility::LogError(
+                "TransformationEstimationPointToPlane and "
+                "TransformationEstimationColoredICP "
+                "require pre-computed normal vectors.");
+    }
+}
+
+// ICP iterations on a source point cloud pcd that is already transformed by
+// init, with a KDTree built on target.
+RegistrationResult RegistrationICPWithKDTree(
+        geometry::PointCloud &pcd,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    Eigen::Matrix4d transformation = init;
+    CorrespondenceBuffer buffer;
+    RegistrationResult result;
+    UpdateRegistrationResultAndCorrespondences(
+            pcd, target, kdtree, max_correspondence_distance, transformation,
+            buffer, result);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        Eigen::Matrix4d update = estimation.ComputeTransformation(
+                pcd, target, result.correspondence_set_);
+        transformation = update * transformation;
+        pcd.Transform(update);
+        double prev_fitness = result.fitness_;
+        double prev_inlier_rmse = result.inlier_rmse_;
+        UpdateRegistrationResultAndCorrespondences(
+                pcd, target, kdtree, max_correspondence_distance,
+                transformation, buffer, result);
+        if (std::abs(prev_fitness - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(prev_inlier_rmse - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+    return result;
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -157,45 +265,89 @@ RegistrationResult RegistrationICP(
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
-    if ((estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::PointToPlane ||
-         estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::ColoredICP) &&
-        (!source.HasNormals() || !target.HasNormals())) {
-        utility::LogError(
-                "TransformationEstimationPointToPlane and "
-                "TransformationEstimationColoredICP "
-                "require pre-computed normal vectors.");
-    }
+    CheckNormalsForEstimation(source, target, estimation);
 
-    Eigen::Matrix4d transformation = init;
     geometry::KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (init.isIdentity() == false) {
         pcd.Transform(init);
     }
-    RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
-    for (int i = 0; i < criteria.max_iteration_; i++) {
-        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
-                          result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
-        transformation = update * transformation;
-        pcd.Transform(update);
-        RegistrationResult backup = result;
-        result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
-        if (std::abs(backup.fitness_ - result.fitness_) <
-                    criteria.relative_fitness_ &&
-            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
-                    criteria.relative_rmse_) {
-            break;
+    return RegistrationICPWithKDTree(pcd, target, kdtree,
+                                     max_correspondence_distance, init,
+                                     estimation, criteria);
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/) {
+    if (voxel_sizes.empty() ||
+        voxel_sizes.size() != max_correspondence_distances.size() ||
+        voxel_sizes.size() != criterias.size()) {
+        utility::LogError(
+                "voxel_sizes, max_correspondence_distances and criterias "
+                "must have the same non-zero size.");
+    }
+    for (double max_correspondence_distance : max_correspondence_distances) {
+        if (max_correspondence_distance <= 0.0) {
+            utility::LogError("Invalid max_correspondence_distance.");
         }
     }
+    CheckNormalsForEstimation(source, target, estimation);
+
+    // Levels with the same voxel size share their point clouds and KDTree.
+    // Levels without downsampling keep a nullptr and use the input clouds.
+    int num_levels = (int)voxel_sizes.size();
+    std::vector<int> level_data(num_levels);
+    std::vector<std::shared_ptr<geometry::PointCloud>> sources;
+    std::vector<std::shared_ptr<geometry::PointCloud>> targets;
+    std::vector<std::shared_ptr<geometry::KDTreeFlann>> kdtrees;
+    for (int i = 0; i < num_levels; i++) {
+        int j = 0;
+        while (j < i && voxel_sizes[j] != voxel_sizes[i]) {
+            j++;
+        }
+        if (j < i) {
+            level_data[i] = level_data[j];
+            continue;
+        }
+        level_data[i] = (int)sources.size();
+        if (voxel_sizes[i] > 0.0) {
+            sources.push_back(source.VoxelDownSample(voxel_sizes[i]));
+            targets.push_back(target.VoxelDownSample(voxel_sizes[i]));
+        } else {
+            sources.push_back(nullptr);
+            targets.push_back(nullptr);
+        }
+        kdtrees.push_back(std::make_shared<geometry::KDTreeFlann>(
+                targets.back() ? *targets.back() : target));
+    }
+
+    RegistrationResult result(init);
+    for (int i = 0; i < num_levels; i++) {
+        int k = level_data[i];
+        const geometry::PointCloud &level_source =
+                sources[k] ? *sources[k] : source;
+        const geometry::PointCloud &level_target =
+                targets[k] ? *targets[k] : target;
+        utility::LogDebug("ICP Scale #{:d}: voxel size {:.4f}, {:d} points", i,
+                          voxel_sizes[i], level_source.points_.size());
+        Eigen::Matrix4d transformation = result.transformation_;
+        geometry::PointCloud pcd = level_source;
+        if (transformation.isIdentity() == false) {
+            pcd.Transform(transformation);
+        }
+        result = RegistrationICPWithKDTree(
+                pcd, level_target, *kdtrees[k],
+                max_correspondence_distances[i], transformation, estimation,
+                criterias[i]);
+    }
     return result;
 }
 
@@ -254,7 +406,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+        /* = RANSACConvergenceCriteria()*/,
+        const geometry::KDTreeIndexParam &feature_index_param
+        /* = geometry::KDTreeIndexParam()*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -264,14 +418,15 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     bool finished_validation = false;
     int num_similar_features = 1;
     std::vector<std::vector<int>> similar_features(source.points_.size());
+    // The trees are only read in the loop and shared by all threads.
+    geometry::KDTreeFlann kdtree(target);
+    geometry::KDTreeFlann kdtree_feature(target_feature, feature_index_param);
 
 #ifdef _OPENMP
 #pragma omp parallel
     {
 #endif
         CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
         RegistrationResult result_private;
 
 #ifdef _OPENMP
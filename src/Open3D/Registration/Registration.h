@@ -30,6 +30,7 @@
 #include <tuple>
 #include <vector>
 
+#include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Eigen.h"
@@ -164,6 +165,33 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Function for coarse-to-fine ICP registration.
+///
+/// Runs ICP on a pyramid of voxel downsampled point clouds, from the first
+/// level to the last one, and initializes each level with the transformation
+/// of the previous one. The downsampled point clouds and the target KDTrees
+/// are built once per distinct voxel size. A voxel size of zero or lower uses
+/// the input point clouds as they are. The correspondence set of the result
+/// refers to the point clouds of the last level.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel size of each level.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of each level.
+/// \param criterias Convergence criteria of each level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false));
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -193,6 +221,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param max_correspondence_distance Maximum correspondence points-pair
 /// distance. \param ransac_n Fit ransac with `ransac_n` correspondences. \param
 /// checkers Correspondence checker. \param criteria Convergence criteria.
+/// \param feature_index_param KDTree index used to match the features, an
+/// approximate index speeds up the matching of large feature sets.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -204,8 +234,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         int ransac_n = 4,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
-        const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+        const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
+        const geometry::KDTreeIndexParam &feature_index_param =
+                geometry::KDTreeIndexParam());
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RobustKernel.h"
+
+#include <cmath>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace registration {
+
+namespace {
+
+double CheckScale(const char *name, double k) {
+    if (!(k > 0.0)) {
+        utility::LogError("[{}] k must be positive, got {}.", name, k);
+    }
+    return k;
+}
+
+}  // unnamed namespace
+
+double L2Loss::Weight(double residual) const { return 1.0; }
+
+HuberLoss::HuberLoss(double k) : k_(CheckScale("HuberLoss", k)) {}
+
+double HuberLoss::Weight(double residual) const {
+    const double e = std::abs(residual);
+    return e <= k_ ? 1.0 : k_ / e;
+}
+
+CauchyLoss::CauchyLoss(double k) : k_(CheckScale("CauchyLoss", k)) {}
+
+double CauchyLoss::Weight(double residual) const {
+    const double e = residual / k_;
+    return 1.0 / (1.0 + e * e);
+}
+
+GMLoss::GMLoss(double k) : k_(CheckScale("GMLoss", k)) {}
+
+double GMLoss::Weight(double residual) const {
+    const double e = residual / k_;
+    const double d = 1.0 + e * e;
+    return 1.0 / (d * d);
+}
+
+TukeyLoss::TukeyLoss(double k) : k_(CheckScale("TukeyLoss", k)) {}
+
+double TukeyLoss::Weight(double residual) const {
+    const double e = residual / k_;
+    if (std::abs(e) > 1.0) {
+        return 0.0;
+    }
+    const double d = 1.0 - e * e;
+    return d * d;
+}
+
+}  // namespace registration
+}  // namespace open3d
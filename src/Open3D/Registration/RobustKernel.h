@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace registration {
+
+/// \class RobustKernel
+///
+/// Base class of the robust loss kernels used for iteratively reweighted
+/// least squares. A kernel with loss rho(r) weights the squared residual r^2
+/// of a correspondence by w(r) = rho'(r) / r. The virtual function Weight()
+/// must be implemented in subclasses.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+
+public:
+    /// Returns the weight of the residual \p residual.
+    virtual double Weight(double residual) const = 0;
+};
+
+/// \class L2Loss
+///
+/// Plain least squares, every residual has weight 1.
+class L2Loss : public RobustKernel {
+public:
+    double Weight(double residual) const override;
+};
+
+/// \class HuberLoss
+///
+/// Quadratic loss for residuals smaller than k_ and linear loss above.
+class HuberLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the residuals with quadratic loss, must be positive.
+    explicit HuberLoss(double k);
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Scale of the residuals with quadratic loss.
+    double k_;
+};
+
+/// \class CauchyLoss
+///
+/// Loss k^2 / 2 * log(1 + (r / k)^2).
+class CauchyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the inlier residuals, must be positive.
+    explicit CauchyLoss(double k);
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Scale of the inlier residuals.
+    double k_;
+};
+
+/// \class GMLoss
+///
+/// Geman-McClure loss r^2 / 2 / (1 + (r / k)^2).
+class GMLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the inlier residuals, must be positive.
+    explicit GMLoss(double k);
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Scale of the inlier residuals.
+    double k_;
+};
+
+/// \class TukeyLoss
+///
+/// Tukey biweight loss, residuals larger than k_ have weight 0.
+class TukeyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Largest residual with a non-zero weight, must be positive.
+    explicit TukeyLoss(double k);
+
+public:
+    double Weight(double residual) const override;
+
+public:
+    /// Largest residual with a non-zero weight.
+    double k_;
+};
+
+}  // namespace registration
+}  // namespace open3d
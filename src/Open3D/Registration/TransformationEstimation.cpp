@@ -29,6 +29,7 @@
 #include <Eigen/Geometry>
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
@@ -60,6 +61,16 @@ Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
     return Eigen::umeyama(source_mat, target_mat, with_scaling_);
 }
 
+TransformationEstimationPointToPlane::TransformationEstimationPointToPlane(
+        std::shared_ptr<RobustKernel> kernel)
+    : kernel_(std::move(kernel)) {
+    if (!kernel_) {
+        utility::LogError(
+                "[TransformationEstimationPointToPlane] kernel must not be "
+                "null.");
+    }
+}
+
 double TransformationEstimationPointToPlane::ComputeRMSE(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -78,15 +89,21 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
+    if (!kernel_) {
+        utility::LogError(
+                "[TransformationEstimationPointToPlane] kernel must not be "
+                "null.");
+    }
     if (corres.empty() || target.HasNormals() == false)
         return Eigen::Matrix4d::Identity();
 
     auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r) {
+                                             double &r, double &w) {
         const Eigen::Vector3d &vs = source.points_[corres[i][0]];
         const Eigen::Vector3d &vt = target.points_[corres[i][1]];
         const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
         r = (vs - vt).dot(nt);
+        w = kernel_->Weight(r);
         J_r.block<3, 1>(0, 0) = vs.cross(nt);
         J_r.block<3, 1>(3, 0) = nt;
     };
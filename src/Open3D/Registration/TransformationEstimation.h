@@ -31,6 +31,8 @@
 #include <string>
 #include <vector>
 
+#include "Open3D/Registration/RobustKernel.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -130,6 +132,12 @@ class TransformationEstimationPointToPlane : public TransformationEstimation {
 public:
     /// \brief Default Constructor.
     TransformationEstimationPointToPlane() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param kernel Robust kernel that weights the point to plane residuals,
+    /// must not be null.
+    explicit TransformationEstimationPointToPlane(
+            std::shared_ptr<RobustKernel> kernel);
     ~TransformationEstimationPointToPlane() override {}
 
 public:
@@ -145,6 +153,12 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Robust kernel that weights the point to plane residuals, must not be
+    /// null. Each call of ComputeTransformation() is one step of iteratively
+    /// reweighted least squares.
+    std::shared_ptr<RobustKernel> kernel_ = std::make_shared<L2Loss>();
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
@@ -170,47 +170,9 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         std::function<void(int, VecType &, double &)> f,
         int iteration_num,
         bool verbose /*=true*/) {
-    MatType JTJ;
-    VecType JTr;
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        MatType JTJ_private;
-        VecType JTr_private;
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
-        VecType J_r;
-        double r;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < iteration_num; i++) {
-            f(i, J_r, r);
-            JTJ_private.noalias() += J_r * J_r.transpose();
-            JTr_private.noalias() += J_r * r;
-            r2_sum_private += r * r;
-        }
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-#ifdef _OPENMP
-        }
-    }
-#endif
-    if (verbose) {
-        LogDebug("Residual : {:.2e} (# of elements : {:d})",
-                 r2_sum / (double)iteration_num, iteration_num);
-    }
-    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+    return ComputeJTJandJTr<MatType, VecType,
+                            std::function<void(int, VecType &, double &)>>(
+            f, iteration_num, verbose);
 }
 
 template <typename MatType, typename VecType>
@@ -221,49 +183,12 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
                      std::vector<double> &)> f,
         int iteration_num,
         bool verbose /*=true*/) {
-    MatType JTJ;
-    VecType JTr;
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        MatType JTJ_private;
-        VecType JTr_private;
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
-        std::vector<double> r;
-        std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < iteration_num; i++) {
-            f(i, J_r, r);
-            for (int j = 0; j < (int)r.size(); j++) {
-                JTJ_private.noalias() += J_r[j] * J_r[j].transpose();
-                JTr_private.noalias() += J_r[j] * r[j];
-                r2_sum_private += r[j] * r[j];
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-#ifdef _OPENMP
-        }
-    }
-#endif
-    if (verbose) {
-        LogDebug("Residual : {:.2e} (# of elements : {:d})",
-                 r2_sum / (double)iteration_num, iteration_num);
-    }
-    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+    return ComputeJTJandJTr<
+            MatType, VecType,
+            std::function<void(
+                    int,
+                    std::vector<VecType, Eigen::aligned_allocator<VecType>> &,
+                    std::vector<double> &)>>(f, iteration_num, verbose);
 }
 
 // clang-format off
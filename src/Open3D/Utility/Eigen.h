@@ -28,9 +28,14 @@
 
 #include <Eigen/Core>
 #include <Eigen/StdVector>
+#include <algorithm>
+#include <functional>
 #include <tuple>
+#include <utility>
 #include <vector>
 
+#include "Open3D/Utility/Console.h"
+
 namespace Eigen {
 
 /// Extending Eigen namespace by adding frequently used matrix type
@@ -113,6 +118,232 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Function to compute JTJ and Jtr, templated on the functor type.
+/// Same as the std::function version, but the call of f is resolved at
+/// compile time, so that it can be inlined into the accumulation loop. This
+/// overload is selected when f is passed as a lambda or another functor.
+template <typename MatType, typename VecType, typename FuncType>
+auto ComputeJTJandJTr(FuncType f, int iteration_num, bool verbose = true)
+        -> decltype(f(0, std::declval<VecType &>(), std::declval<double &>()),
+                    std::tuple<MatType, VecType, double>()) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        VecType J_r;
+        double r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r);
+            JTJ_private.noalias() += J_r * J_r.transpose();
+            JTr_private.noalias() += J_r * r;
+            r2_sum_private += r * r;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+/// Function to compute weighted JTJ and Jtr, templated on the functor type.
+/// Input: functor f and total number of rows of Jacobian matrix
+/// Output: sum of w * J^T * J, sum of w * J^T * r, sum of r^2
+/// Note: f(i, J_r, r, w) outputs the row vector, residual and weight of row i,
+/// e.g. the weight of a robust kernel for iteratively reweighted least squares.
+template <typename MatType, typename VecType, typename FuncType>
+auto ComputeJTJandJTr(FuncType f, int iteration_num, bool verbose = true)
+        -> decltype(f(0,
+                      std::declval<VecType &>(),
+                      std::declval<double &>(),
+                      std::declval<double &>()),
+                    std::tuple<MatType, VecType, double>()) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        VecType J_r;
+        double r;
+        double w;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r, w);
+            JTJ_private.noalias() += J_r * w * J_r.transpose();
+            JTr_private.noalias() += J_r * w * r;
+            r2_sum_private += r * r;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+/// Function to compute JTJ and Jtr, templated on the functor type, for
+/// functors that output several rows per index.
+template <typename MatType, typename VecType, typename FuncType>
+auto ComputeJTJandJTr(FuncType f, int iteration_num, bool verbose = true)
+        -> decltype(f(0,
+                      std::declval<std::vector<
+                              VecType, Eigen::aligned_allocator<VecType>> &>(),
+                      std::declval<std::vector<double> &>()),
+                    std::tuple<MatType, VecType, double>()) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        std::vector<double> r;
+        std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r);
+            for (int j = 0; j < (int)r.size(); j++) {
+                JTJ_private.noalias() += J_r[j] * J_r[j].transpose();
+                JTr_private.noalias() += J_r[j] * r[j];
+                r2_sum_private += r[j] * r[j];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+/// Function to compute JTJ and Jtr from blocks of rows.
+/// Input: functor f, total number of rows of Jacobian matrix and number of
+/// rows per block
+/// Output: JTJ, JTr, sum of r^2
+/// Note: f(begin, end, J, r) outputs the row vectors and residuals of the
+/// rows [begin, end) in the rows of J and r, which have end - begin rows.
+/// Rows without a residual must be set to zero. Each block is accumulated
+/// with a matrix product rather than one rank-1 update per row, which pays off
+/// when rows are wide or the matrix product is vectorized.
+template <typename MatType, typename VecType, typename FuncType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTrBlock(
+        FuncType f,
+        int iteration_num,
+        int block_size = 256,
+        bool verbose = true) {
+    typedef Eigen::Matrix<double, Eigen::Dynamic, VecType::RowsAtCompileTime>
+            BlockJacobian;
+    int num_blocks = (iteration_num + block_size - 1) / block_size;
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        BlockJacobian J;
+        Eigen::VectorXd r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int block = 0; block < num_blocks; block++) {
+            int begin = block * block_size;
+            int end = std::min(begin + block_size, iteration_num);
+            J.resize(end - begin, Eigen::NoChange);
+            r.resize(end - begin);
+            f(begin, end, J, r);
+            JTJ_private.noalias() += J.transpose() * J;
+            JTr_private.noalias() += J.transpose() * r;
+            r2_sum_private += r.squaredNorm();
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
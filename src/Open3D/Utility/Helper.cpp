@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <numeric>
 #include <random>
 #include <unordered_set>
 
@@ -106,6 +107,69 @@ void Sleep(int milliseconds) {
 #endif  // _WIN32
 }
 
+namespace {
+
+/// Digit width of RadixSortKeys.
+static constexpr int RADIX_BITS = 11;
+
+/// Number of keys counted and scattered by one task in RadixSortKeys.
+static constexpr int64_t RADIX_CHUNK_SIZE = 1 << 16;
+
+}  // unnamed namespace
+
+void RadixSortKeys(std::vector<uint64_t>& keys,
+                   uint64_t max_key,
+                   std::vector<int>& order) {
+    const int64_t n = int64_t(keys.size());
+    const int64_t num_digits = int64_t(1) << RADIX_BITS;
+    const uint64_t digit_mask = uint64_t(num_digits - 1);
+    const int64_t num_chunks = (n + RADIX_CHUNK_SIZE - 1) / RADIX_CHUNK_SIZE;
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint64_t> sorted_keys(n);
+    std::vector<int> sorted_order(n);
+    // counts[c * num_digits + d] is the number of keys of digit d in chunk
+    // c, and then the position of the first of them in the output.
+    std::vector<int64_t> counts(num_chunks * num_digits);
+    for (int shift = 0; shift == 0 || (shift < 64 && (max_key >> shift) > 0);
+         shift += RADIX_BITS) {
+        std::fill(counts.begin(), counts.end(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t c = 0; c < num_chunks; c++) {
+            int64_t *chunk_counts = counts.data() + c * num_digits;
+            const int64_t end = std::min(n, (c + 1) * RADIX_CHUNK_SIZE);
+            for (int64_t i = c * RADIX_CHUNK_SIZE; i < end; i++) {
+                chunk_counts[(keys[i] >> shift) & digit_mask]++;
+            }
+        }
+        int64_t sum = 0;
+        for (int64_t d = 0; d < num_digits; d++) {
+            for (int64_t c = 0; c < num_chunks; c++) {
+                int64_t &count = counts[c * num_digits + d];
+                std::swap(count, sum);
+                sum += count;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t c = 0; c < num_chunks; c++) {
+            int64_t *chunk_counts = counts.data() + c * num_digits;
+            const int64_t end = std::min(n, (c + 1) * RADIX_CHUNK_SIZE);
+            for (int64_t i = c * RADIX_CHUNK_SIZE; i < end; i++) {
+                int64_t position = chunk_counts[(keys[i] >> shift) &
+                                                digit_mask]++;
+                sorted_keys[position] = keys[i];
+                sorted_order[position] = order[i];
+            }
+        }
+        keys.swap(sorted_keys);
+        order.swap(sorted_order);
+    }
+}
+
 int UniformRandInt(const int min, const int max) {
     static thread_local std::mt19937 generator(std::random_device{}());
     std::uniform_int_distribution<int> distribution(min, max);
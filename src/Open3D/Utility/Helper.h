@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <string>
@@ -152,6 +153,15 @@ inline int DivUp(int x, int y) {
     return tmp.quot + (tmp.rem != 0 ? 1 : 0);
 }
 
+/// \brief Stable parallel LSD radix sort of 64-bit keys.
+///
+/// Sorts the keys in place and returns in order the input position of each
+/// sorted key. Only the bits needed for max_key are sorted on, so that a few
+/// passes suffice for small key ranges.
+void RadixSortKeys(std::vector<uint64_t>& keys,
+                   uint64_t max_key,
+                   std::vector<int>& order);
+
 /// Thread-safe function returning a pseudo-random integer.
 /// The integer is drawn from a uniform distribution bounded by min and max
 /// (inclusive)
@@ -4,16 +4,22 @@ import numpy as np
 
 
 def _numpy_dtype_to_dtype(numpy_dtype):
-    if numpy_dtype == np.float32:
+    if numpy_dtype == np.float16:
+        return o3d.Dtype.Float16
+    elif numpy_dtype == np.float32:
         return o3d.Dtype.Float32
     elif numpy_dtype == np.float64:
         return o3d.Dtype.Float64
+    elif numpy_dtype == np.int16:
+        return o3d.Dtype.Int16
     elif numpy_dtype == np.int32:
         return o3d.Dtype.Int32
     elif numpy_dtype == np.int64:
         return o3d.Dtype.Int64
     elif numpy_dtype == np.uint8:
         return o3d.Dtype.UInt8
+    elif numpy_dtype == np.uint16:
+        return o3d.Dtype.UInt16
     elif numpy_dtype == np.bool:
         return o3d.Dtype.Bool
     else:
@@ -62,10 +68,13 @@ def _to_o3d_tensor_key(key):
             o3d.none if key.stop == None else key.stop,
             o3d.none if key.step == None else key.step)
     elif isinstance(key, (tuple, list)):
-        key = np.array(key).astype(np.int64)
+        key = np.array(key)
+        if key.dtype != np.bool_:
+            key = key.astype(np.int64)
         return o3d.open3d_pybind.TensorKey.index_tensor(Tensor(key))
     elif isinstance(key, np.ndarray):
-        key = key.astype(np.int64)
+        if key.dtype != np.bool_:
+            key = key.astype(np.int64)
         return o3d.open3d_pybind.TensorKey.index_tensor(Tensor(key))
     elif isinstance(key, Tensor):
         return o3d.open3d_pybind.TensorKey.index_tensor(key)
@@ -611,6 +620,24 @@ class Tensor(open3d_pybind.Tensor):
             raise TypeError(f"dim must be int or None, but got {dim}")
         return super(Tensor, self).argmax_(dim)
 
+    def nonzero(self, as_tuple=False):
+        """
+        Returns the indices of the non-zero elements. By default, the result
+        is an int64 tensor of shape (ndim, num_non_zeros). If `as_tuple` is
+        True, returns a tuple of ndim 1-D int64 tensors as numpy.nonzero, which
+        can be used for indexing directly.
+        """
+        if as_tuple:
+            results = []
+            for t in super(Tensor, self)._nonzero_numpy():
+                result = Tensor([])
+                result.shallow_copy_from(t)
+                results.append(result)
+            return tuple(results)
+        result = Tensor([])
+        result.shallow_copy_from(super(Tensor, self).nonzero())
+        return result
+
     def __lt__(self, value):
         return self.lt(value)
 
@@ -36,4 +36,5 @@ void pybind_core(py::module &m) {
     pybind_core_tensor_key(m);
     pybind_core_tensor(m);
     pybind_core_tensorlist(m);
+    pybind_core_kernel_profiler(m);
 }
@@ -38,3 +38,4 @@ void pybind_core_size_vector(py::module& m);
 void pybind_core_tensor_key(py::module& m);
 void pybind_core_tensor(py::module& m);
 void pybind_core_tensorlist(py::module& m);
+void pybind_core_kernel_profiler(py::module& m);
@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d_pybind/core/container.h"
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+
+#include "Open3D/Core/KernelProfiler.h"
+
+using namespace open3d;
+
+void pybind_core_kernel_profiler(py::module &m) {
+    py::module m_profiler = m.def_submodule(
+            "kernel_profiler",
+            "Records Tensor kernel launches for Chrome trace export.");
+
+    m_profiler.def("enable", &KernelProfiler::Enable,
+                   "Start recording Tensor kernel launches.");
+    m_profiler.def("disable", &KernelProfiler::Disable,
+                   "Stop recording Tensor kernel launches.");
+    m_profiler.def("is_enabled", &KernelProfiler::IsEnabled);
+    m_profiler.def("set_capacity", &KernelProfiler::SetCapacity,
+                   "Set the number of kept events and clear the recorded "
+                   "events.",
+                   "capacity"_a);
+    m_profiler.def("get_capacity", &KernelProfiler::GetCapacity);
+    m_profiler.def("clear", &KernelProfiler::Clear,
+                   "Clear the recorded events.");
+    m_profiler.def("to_chrome_trace", &KernelProfiler::ToChromeTrace,
+                   "Return the recorded events as a Chrome trace JSON string.");
+    m_profiler.def("write_chrome_trace", &KernelProfiler::WriteChromeTrace,
+                   "Write the recorded events to a Chrome trace JSON file.",
+                   "filename"_a);
+}
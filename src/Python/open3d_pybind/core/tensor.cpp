@@ -385,6 +385,10 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("argmin_", &Tensor::ArgMin);
     tensor.def("argmax_", &Tensor::ArgMax);
 
+    // Boolean mask helpers
+    tensor.def("nonzero", &Tensor::NonZero);
+    tensor.def("_nonzero_numpy", &Tensor::NonZeroNumpy);
+
     tensor.def("__repr__",
                [](const Tensor& tensor) { return tensor.ToString(); });
     tensor.def("__str__",
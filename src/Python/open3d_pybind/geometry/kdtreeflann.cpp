@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -110,6 +112,29 @@ void pybind_kdtreeflann(py::module &m) {
                     "max_nn", &geometry::KDTreeSearchParamHybrid::max_nn_,
                     "At maximum, ``max_nn`` neighbors will be searched.");
 
+    // open3d.geometry.KDTreeIndexParam
+    py::class_<geometry::KDTreeIndexParam> kdtreeindexparam(
+            m, "KDTreeIndexParam",
+            "KDTree index parameters, selecting exact or approximate search.");
+    kdtreeindexparam
+            .def(py::init<int, int>(), "num_trees"_a = 0, "checks"_a = 128)
+            .def("__repr__",
+                 [](const geometry::KDTreeIndexParam &param) {
+                     return std::string(
+                                    "geometry::KDTreeIndexParam with "
+                                    "num_trees = ") +
+                            std::to_string(param.num_trees_) +
+                            " and checks = " + std::to_string(param.checks_);
+                 })
+            .def("is_approximate", &geometry::KDTreeIndexParam::IsApproximate,
+                 "Returns true if the index is searched approximately.")
+            .def_readwrite("num_trees",
+                           &geometry::KDTreeIndexParam::num_trees_,
+                           "Number of randomized trees, 0 for exact search.")
+            .def_readwrite("checks", &geometry::KDTreeIndexParam::checks_,
+                           "Maximum number of leaves visited per query in "
+                           "approximate search.");
+
     // open3d.geometry.KDTreeFlann
     static const std::unordered_map<std::string, std::string>
             map_kd_tree_flann_method_docs = {
@@ -124,13 +149,21 @@ void pybind_kdtreeflann(py::module &m) {
             kdtreeflann(m, "KDTreeFlann",
                         "KDTree with FLANN for nearest neighbor search.");
     kdtreeflann.def(py::init<>())
-            .def(py::init<const Eigen::MatrixXd &>(), "data"_a)
+            .def(py::init<const geometry::KDTreeIndexParam &>(),
+                 "index_param"_a)
+            .def(py::init<const Eigen::MatrixXd &,
+                          const geometry::KDTreeIndexParam &>(),
+                 "data"_a, "index_param"_a = geometry::KDTreeIndexParam())
             .def("set_matrix_data", &geometry::KDTreeFlann::SetMatrixData,
                  "Sets the data for the KDTree from a matrix.", "data"_a)
-            .def(py::init<const geometry::Geometry &>(), "geometry"_a)
+            .def(py::init<const geometry::Geometry &,
+                          const geometry::KDTreeIndexParam &>(),
+                 "geometry"_a, "index_param"_a = geometry::KDTreeIndexParam())
             .def("set_geometry", &geometry::KDTreeFlann::SetGeometry,
                  "Sets the data for the KDTree from geometry.", "geometry"_a)
-            .def(py::init<const registration::Feature &>(), "feature"_a)
+            .def(py::init<const registration::Feature &,
+                          const geometry::KDTreeIndexParam &>(),
+                 "feature"_a, "index_param"_a = geometry::KDTreeIndexParam())
             .def("set_feature", &geometry::KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
                  "feature"_a)
@@ -273,4 +306,82 @@ void pybind_kdtreeflann(py::module &m) {
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "set_matrix_data",
                                     map_kd_tree_flann_method_docs);
+
+    // open3d.geometry.NeighborGraph
+    py::class_<geometry::NeighborGraph,
+               std::shared_ptr<geometry::NeighborGraph>>
+            neighborgraph(m, "NeighborGraph",
+                          "Neighborhoods of all the points of a point cloud, "
+                          "stored as a compressed sparse row adjacency with "
+                          "squared distances, reusable across point cloud "
+                          "operations.");
+    neighborgraph.def(py::init<>())
+            .def(py::init<const geometry::PointCloud &,
+                          const geometry::KDTreeSearchParam &>(),
+                 "cloud"_a, "search_param"_a)
+            .def(py::init<const geometry::PointCloud &,
+                          const geometry::KDTreeSearchParam &,
+                          const geometry::KDTreeFlann &>(),
+                 "cloud"_a, "search_param"_a, "kdtree"_a)
+            .def("build",
+                 (bool (geometry::NeighborGraph::*)(
+                         const geometry::PointCloud &,
+                         const geometry::KDTreeSearchParam &)) &
+                         geometry::NeighborGraph::Build,
+                 "Searches the neighborhoods of all the points of the cloud.",
+                 "cloud"_a, "search_param"_a)
+            .def("build",
+                 (bool (geometry::NeighborGraph::*)(
+                         const geometry::PointCloud &,
+                         const geometry::KDTreeSearchParam &,
+                         const geometry::KDTreeFlann &)) &
+                         geometry::NeighborGraph::Build,
+                 "Searches the neighborhoods of all the points of the cloud "
+                 "in a prebuilt KDTree.",
+                 "cloud"_a, "search_param"_a, "kdtree"_a)
+            .def("clear", &geometry::NeighborGraph::Clear,
+                 "Removes all the nodes and edges of the graph.")
+            .def("is_empty", &geometry::NeighborGraph::IsEmpty,
+                 "Returns True if the graph has no nodes.")
+            .def("get_node_count", &geometry::NeighborGraph::GetNodeCount,
+                 "Returns the number of nodes.")
+            .def("get_edge_count", &geometry::NeighborGraph::GetEdgeCount,
+                 "Returns the total number of edges, self edges included.")
+            .def("get_neighbor_count",
+                 &geometry::NeighborGraph::GetNeighborCount,
+                 "Returns the number of neighbors of a node, itself "
+                 "included.",
+                 "i"_a)
+            .def("get_neighbors",
+                 [](const geometry::NeighborGraph &graph, size_t i) {
+                     if (i >= graph.GetNodeCount())
+                         throw std::runtime_error("get_neighbors() error!");
+                     std::vector<int> indices;
+                     std::vector<double> distance2;
+                     int k = graph.GetNeighbors(i, indices, distance2);
+                     return std::make_tuple(k, indices, distance2);
+                 },
+                 "Returns the neighbors of a node and their squared "
+                 "distances, sorted by distance.",
+                 "i"_a)
+            .def("get_search_type", &geometry::NeighborGraph::GetSearchType,
+                 "Returns the search type the graph was built with.")
+            .def("get_radius", &geometry::NeighborGraph::GetRadius,
+                 "Returns the search radius of Radius and Hybrid graphs.")
+            .def("get_max_nn", &geometry::NeighborGraph::GetMaxNN,
+                 "Returns the maximum number of neighbors of Knn and Hybrid "
+                 "graphs.")
+            .def("__repr__",
+                 [](const geometry::NeighborGraph &graph) {
+                     return std::string("NeighborGraph with ") +
+                            std::to_string(graph.GetNodeCount()) +
+                            " nodes and " +
+                            std::to_string(graph.GetEdgeCount()) + " edges.";
+                 })
+            .def_readonly("indices", &geometry::NeighborGraph::indices_,
+                          "Neighbor indices of all the nodes.")
+            .def_readonly("distance2", &geometry::NeighborGraph::distance2_,
+                          "Squared distances to the neighbors.")
+            .def_readonly("offsets", &geometry::NeighborGraph::offsets_,
+                          "Offsets of the neighbors of each node.");
 }
@@ -28,6 +28,8 @@
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
 
@@ -110,21 +112,72 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove non-finite points from the PointCloud",
                  "remove_nan"_a = true, "remove_infinite"_a = true)
             .def("remove_radius_outlier",
-                 &geometry::PointCloud::RemoveRadiusOutliers,
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double) const) &
+                         geometry::PointCloud::RemoveRadiusOutliers,
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
+            .def("remove_radius_outlier",
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double, const geometry::KDTreeFlann &) const) &
+                         geometry::PointCloud::RemoveRadiusOutliers,
+                 "Function to remove points that have less than nb_points"
+                 " in a given sphere of a given radius, reusing a KDTree "
+                 "built on the point cloud",
+                 "nb_points"_a, "radius"_a, "kdtree"_a)
             .def("remove_statistical_outlier",
-                 &geometry::PointCloud::RemoveStatisticalOutliers,
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double) const) &
+                         geometry::PointCloud::RemoveStatisticalOutliers,
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
-            .def("estimate_normals", &geometry::PointCloud::EstimateNormals,
+            .def("remove_statistical_outlier",
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double, const geometry::KDTreeFlann &) const) &
+                         geometry::PointCloud::RemoveStatisticalOutliers,
+                 "Function to remove points that are further away from their "
+                 "neighbors in average, reusing a KDTree built on the point "
+                 "cloud",
+                 "nb_neighbors"_a, "std_ratio"_a, "kdtree"_a)
+            .def("remove_statistical_outlier",
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &, double) const) &
+                         geometry::PointCloud::RemoveStatisticalOutliers,
+                 "Function to remove points that are further away from their "
+                 "neighbors in average, reusing a neighbor graph of the point "
+                 "cloud",
+                 "graph"_a, "std_ratio"_a)
+            .def("estimate_normals",
+                 (bool (geometry::PointCloud::*)(
+                         const geometry::KDTreeSearchParam &, bool)) &
+                         geometry::PointCloud::EstimateNormals,
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
                  "search_param"_a = geometry::KDTreeSearchParamKNN(),
                  "fast_normal_computation"_a = true)
+            .def("estimate_normals",
+                 (bool (geometry::PointCloud::*)(
+                         const geometry::KDTreeSearchParam &, bool,
+                         const geometry::KDTreeFlann &)) &
+                         geometry::PointCloud::EstimateNormals,
+                 "Function to compute the normals of a point cloud, reusing "
+                 "a KDTree built on the point cloud",
+                 "search_param"_a, "fast_normal_computation"_a, "kdtree"_a)
+            .def("estimate_normals",
+                 (bool (geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &, bool)) &
+                         geometry::PointCloud::EstimateNormals,
+                 "Function to compute the normals of a point cloud from the "
+                 "neighborhoods of a neighbor graph of the point cloud",
+                 "graph"_a, "fast_normal_computation"_a = true)
             .def("orient_normals_to_align_with_direction",
                  &geometry::PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -151,9 +204,18 @@ void pybind_pointcloud(py::module &m) {
                  "cloud. See: "
                  "https://en.wikipedia.org/wiki/Mahalanobis_distance.")
             .def("compute_nearest_neighbor_distance",
-                 &geometry::PointCloud::ComputeNearestNeighborDistance,
+                 (std::vector<double>(geometry::PointCloud::*)() const) &
+                         geometry::PointCloud::ComputeNearestNeighborDistance,
                  "Function to compute the distance from a point to its nearest "
                  "neighbor in the point cloud")
+            .def("compute_nearest_neighbor_distance",
+                 (std::vector<double>(geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &) const) &
+                         geometry::PointCloud::ComputeNearestNeighborDistance,
+                 "Function to compute the distance from a point to its nearest "
+                 "neighbor in the point cloud, reusing a neighbor graph of the "
+                 "point cloud",
+                 "graph"_a)
             .def("compute_convex_hull",
                  &geometry::PointCloud::ComputeConvexHull,
                  "Computes the convex hull of the point cloud.")
@@ -166,16 +228,34 @@ void pybind_pointcloud(py::module &m) {
                  "found in Mehra et. al. 'Visibility of Noisy Point Cloud "
                  "Data', 2010.",
                  "camera_location"_a, "radius"_a)
-            .def("cluster_dbscan", &geometry::PointCloud::ClusterDBSCAN,
+            .def("cluster_dbscan",
+                 (std::vector<int>(geometry::PointCloud::*)(double, size_t,
+                                                            bool) const) &
+                         geometry::PointCloud::ClusterDBSCAN,
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
                  "eps"_a, "min_points"_a, "print_progress"_a = false)
+            .def("cluster_dbscan",
+                 (std::vector<int>(geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &, size_t, bool) const) &
+                         geometry::PointCloud::ClusterDBSCAN,
+                 "Cluster PointCloud using the DBSCAN algorithm, reusing a "
+                 "radius neighbor graph of the point cloud whose radius is "
+                 "the density parameter eps.",
+                 "graph"_a, "min_points"_a, "print_progress"_a = false)
             .def("segment_plane", &geometry::PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999)
+            .def("segment_planes", &geometry::PointCloud::SegmentPlanes,
+                 "Segments several planes in the point cloud one after the "
+                 "other using the RANSAC algorithm.",
+                 "max_planes"_a, "min_num_inliers"_a,
+                 "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                 "num_iterations"_a = 100, "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &geometry::PointCloud::CreateFromDepthImage,
@@ -304,7 +384,24 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane. Set to 1 "
+              "to always run num_iterations iterations."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"max_planes", "Maximum number of planes to segment."},
+             {"min_num_inliers",
+              "Segmentation stops at the first plane with fewer inliers."},
+             {"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"probability",
+              "Expected probability of finding the optimal plane."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -33,6 +33,25 @@
 
 #include "open3d_pybind/open3d_pybind.h"
 
+namespace pybind11 {
+namespace detail {
+
+/// Maps open3d::Float16 to numpy.float16, so that py::array_t<Float16> works
+/// like the other Tensor dtypes.
+template <>
+struct npy_format_descriptor<open3d::Float16> {
+    static constexpr auto name = _("float16");
+    static pybind11::dtype dtype() {
+        // NPY_HALF is not part of pybind11's npy_api enum.
+        constexpr int NPY_HALF = 23;
+        handle ptr = npy_api::get().PyArray_DescrFromType_(NPY_HALF);
+        return reinterpret_steal<pybind11::dtype>(ptr);
+    }
+};
+
+}  // namespace detail
+}  // namespace pybind11
+
 namespace open3d {
 namespace pybind_utils {
 
@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 
 #include "open3d_pybind/docstring.h"
@@ -63,11 +65,47 @@ void pybind_feature(py::module &m) {
 }
 
 void pybind_feature_methods(py::module &m) {
-    m.def("compute_fpfh_feature", &registration::ComputeFPFHFeature,
+    m.def("compute_fpfh_feature",
+          (std::shared_ptr<registration::Feature>(*)(
+                  const geometry::PointCloud &,
+                  const geometry::KDTreeSearchParam &)) &
+                  registration::ComputeFPFHFeature,
           "Function to compute FPFH feature for a point cloud", "input"_a,
           "search_param"_a);
+    m.def("compute_fpfh_feature",
+          (std::shared_ptr<registration::Feature>(*)(
+                  const geometry::PointCloud &,
+                  const geometry::KDTreeSearchParam &,
+                  const geometry::KDTreeFlann &)) &
+                  registration::ComputeFPFHFeature,
+          "Function to compute FPFH feature for a point cloud, reusing a "
+          "KDTree built on the point cloud",
+          "input"_a, "search_param"_a, "kdtree"_a);
+    m.def("compute_fpfh_feature",
+          (std::shared_ptr<registration::Feature>(*)(
+                  const geometry::PointCloud &,
+                  const geometry::NeighborGraph &)) &
+                  registration::ComputeFPFHFeature,
+          "Function to compute FPFH feature for a point cloud from the "
+          "neighborhoods of a neighbor graph of the point cloud",
+          "input"_a, "graph"_a);
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("correspondences_from_features",
+          &registration::CorrespondencesFromFeatures,
+          "Function to match features by nearest neighbor in feature space",
+          "source_feature"_a, "target_feature"_a, "mutual_filter"_a = false,
+          "index_param"_a = geometry::KDTreeIndexParam());
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_feature", "Source features."},
+             {"target_feature", "Target features."},
+             {"mutual_filter",
+              "Only keep the mutual nearest neighbor pairs."},
+             {"index_param",
+              "KDTree index used for the searches, an approximate index "
+              "speeds up the matching of large feature sets."}});
 }
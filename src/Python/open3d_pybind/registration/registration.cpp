@@ -30,6 +30,7 @@
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Console.h"
 
@@ -223,6 +224,107 @@ The homogeneous transformation is given by
 Sets :math:`c = 1` if ``with_scaling`` is ``False``.
 )");
 
+    // open3d.registration.RobustKernel
+    // The kernels are evaluated inside OpenMP loops without the GIL, so they
+    // cannot be subclassed in Python.
+    py::class_<registration::RobustKernel,
+               std::shared_ptr<registration::RobustKernel>>
+            rk(m, "RobustKernel",
+               "Base class of the robust loss kernels used for iteratively "
+               "reweighted least squares.");
+    rk.def("weight", &registration::RobustKernel::Weight, "residual"_a,
+           "Returns the weight of a residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, std::shared_ptr<registration::L2Loss>,
+               registration::RobustKernel>
+            l2_loss(m, "L2Loss",
+                    "Plain least squares, every residual has weight 1.");
+    py::detail::bind_default_constructor<registration::L2Loss>(l2_loss);
+    py::detail::bind_copy_functions<registration::L2Loss>(l2_loss);
+    l2_loss.def("__repr__", [](const registration::L2Loss &rk) {
+        return std::string("registration::L2Loss");
+    });
+
+    // open3d.registration.HuberLoss: RobustKernel
+    py::class_<registration::HuberLoss,
+               std::shared_ptr<registration::HuberLoss>,
+               registration::RobustKernel>
+            huber_loss(m, "HuberLoss",
+                       "Quadratic loss for residuals smaller than k and "
+                       "linear loss above.");
+    py::detail::bind_copy_functions<registration::HuberLoss>(huber_loss);
+    huber_loss
+            .def(py::init([](double k) {
+                     return new registration::HuberLoss(k);
+                 }),
+                 "k"_a)
+            .def("__repr__",
+                 [](const registration::HuberLoss &rk) {
+                     return fmt::format("registration::HuberLoss with k={}",
+                                        rk.k_);
+                 })
+            .def_readonly("k", &registration::HuberLoss::k_,
+                          "float: Scale of the residuals with quadratic "
+                          "loss.");
+
+    // open3d.registration.CauchyLoss: RobustKernel
+    py::class_<registration::CauchyLoss,
+               std::shared_ptr<registration::CauchyLoss>,
+               registration::RobustKernel>
+            cauchy_loss(m, "CauchyLoss",
+                        "Cauchy loss ``k^2 / 2 * log(1 + (r / k)^2)``.");
+    py::detail::bind_copy_functions<registration::CauchyLoss>(cauchy_loss);
+    cauchy_loss
+            .def(py::init([](double k) {
+                     return new registration::CauchyLoss(k);
+                 }),
+                 "k"_a)
+            .def("__repr__",
+                 [](const registration::CauchyLoss &rk) {
+                     return fmt::format("registration::CauchyLoss with k={}",
+                                        rk.k_);
+                 })
+            .def_readonly("k", &registration::CauchyLoss::k_,
+                          "float: Scale of the inlier residuals.");
+
+    // open3d.registration.GMLoss: RobustKernel
+    py::class_<registration::GMLoss, std::shared_ptr<registration::GMLoss>,
+               registration::RobustKernel>
+            gm_loss(m, "GMLoss",
+                    "Geman-McClure loss ``r^2 / 2 / (1 + (r / k)^2)``.");
+    py::detail::bind_copy_functions<registration::GMLoss>(gm_loss);
+    gm_loss.def(py::init([](double k) { return new registration::GMLoss(k); }),
+                "k"_a)
+            .def("__repr__",
+                 [](const registration::GMLoss &rk) {
+                     return fmt::format("registration::GMLoss with k={}",
+                                        rk.k_);
+                 })
+            .def_readonly("k", &registration::GMLoss::k_,
+                          "float: Scale of the inlier residuals.");
+
+    // open3d.registration.TukeyLoss: RobustKernel
+    py::class_<registration::TukeyLoss,
+               std::shared_ptr<registration::TukeyLoss>,
+               registration::RobustKernel>
+            tukey_loss(m, "TukeyLoss",
+                       "Tukey biweight loss, residuals larger than k have "
+                       "weight 0.");
+    py::detail::bind_copy_functions<registration::TukeyLoss>(tukey_loss);
+    tukey_loss
+            .def(py::init([](double k) {
+                     return new registration::TukeyLoss(k);
+                 }),
+                 "k"_a)
+            .def("__repr__",
+                 [](const registration::TukeyLoss &rk) {
+                     return fmt::format("registration::TukeyLoss with k={}",
+                                        rk.k_);
+                 })
+            .def_readonly("k", &registration::TukeyLoss::k_,
+                          "float: Largest residual with a non-zero weight.");
+
     // open3d.registration.TransformationEstimationPointToPlane:
     // TransformationEstimation
     py::class_<registration::TransformationEstimationPointToPlane,
@@ -236,11 +338,32 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
             registration::TransformationEstimationPointToPlane>(te_p2l);
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPlane>(te_p2l);
-    te_p2l.def(
-            "__repr__",
-            [](const registration::TransformationEstimationPointToPlane &te) {
-                return std::string("TransformationEstimationPointToPlane");
-            });
+    te_p2l.def(py::init([](std::shared_ptr<registration::RobustKernel> kernel) {
+                   return new registration::
+                           TransformationEstimationPointToPlane(
+                                   std::move(kernel));
+               }),
+               "kernel"_a)
+            .def("__repr__",
+                 [](const registration::TransformationEstimationPointToPlane
+                            &te) {
+                     return std::string("TransformationEstimationPointToPlane");
+                 })
+            .def_property(
+                    "kernel",
+                    [](const registration::TransformationEstimationPointToPlane
+                               &te) { return te.kernel_; },
+                    [](registration::TransformationEstimationPointToPlane &te,
+                       std::shared_ptr<registration::RobustKernel> kernel) {
+                        if (!kernel) {
+                            utility::LogError(
+                                    "[TransformationEstimationPointToPlane] "
+                                    "kernel must not be None.");
+                        }
+                        te.kernel_ = std::move(kernel);
+                    },
+                    "Robust kernel that weights the point to plane "
+                    "residuals.");
 
     // open3d.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
@@ -385,17 +508,21 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             const geometry::KDTreeIndexParam
+                                     &feature_index_param) {
                      return new registration::FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count,
+                             feature_index_param);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "feature_index_param"_a = geometry::KDTreeIndexParam())
             .def_readwrite(
                     "division_factor",
                     &registration::FastGlobalRegistrationOption::
@@ -429,6 +556,11 @@ must hold true for all edges.)");
                            &registration::FastGlobalRegistrationOption::
                                    maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite("feature_index_param",
+                           &registration::FastGlobalRegistrationOption::
+                                   feature_index_param_,
+                           "KDTreeIndexParam: KDTree index used to match the "
+                           "features.")
             .def("__repr__",
                  [](const registration::FastGlobalRegistrationOption &c) {
                      return fmt::format(
@@ -497,6 +629,10 @@ static const std::unordered_map<std::string, std::string>
                  "``registration::CorrespondenceCheckerBasedOnDistance``, "
                  "``registration::CorrespondenceCheckerBasedOnNormal``)"},
                 {"criteria", "Convergence criteria"},
+                {"criterias", "Convergence criteria of each level"},
+                {"feature_index_param",
+                 "KDTree index used to match the features, an approximate "
+                 "index speeds up the matching of large feature sets."},
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``registration::TransformationEstimationPointToPoint``, "
@@ -505,6 +641,9 @@ static const std::unordered_map<std::string, std::string>
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"max_correspondence_distances",
+                 "Maximum correspondence points-pair distance of each "
+                 "level."},
                 {"option", "Registration option"},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
@@ -513,7 +652,10 @@ static const std::unordered_map<std::string, std::string>
                 {"target", "The target point cloud."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
-                 "``target``"}};
+                 "``target``"},
+                {"voxel_sizes",
+                 "Voxel size of each level, from coarse to fine. A voxel size "
+                 "of zero or lower uses the input point clouds."}};
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &registration::EvaluateRegistration,
@@ -533,6 +675,18 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("registration_multi_scale_icp",
+          &registration::RegistrationMultiScaleICP,
+          "Function for coarse-to-fine ICP registration on a voxel "
+          "downsampled pyramid",
+          "source"_a, "target"_a, "voxel_sizes"_a,
+          "max_correspondence_distances"_a, "criterias"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false));
+    docstring::FunctionDocInject(m, "registration_multi_scale_icp",
+                                 map_shared_argument_docstrings);
+
     m.def("registration_colored_icp", &registration::RegistrationColoredICP,
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
@@ -565,7 +719,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 4,
           "checkers"_a = std::vector<std::reference_wrapper<
                   const registration::CorrespondenceChecker>>(),
-          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100));
+          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100),
+          "feature_index_param"_a = geometry::KDTreeIndexParam());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -63,3 +63,18 @@ TEST_P(BlobPermuteDevices, BlobConstructorWithExternalMemory) {
     }
     EXPECT_TRUE(deleter_called);
 }
+
+TEST_P(BlobPermuteDevices, BlobConstructorView) {
+    Device device = GetParam();
+
+    void* data_ptr = MemoryManager::Malloc(8, device);
+    auto owner = std::make_shared<int>(0);
+    {
+        Blob b(device, data_ptr, owner);
+        EXPECT_EQ(b.GetDataPtr(), data_ptr);
+        EXPECT_EQ(owner.use_count(), 2);
+    }
+    // The view released the keepalive but did not free the memory.
+    EXPECT_EQ(owner.use_count(), 1);
+    MemoryManager::Free(data_ptr, device);
+}
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Float16.h"
+
+#include <cmath>
+#include <limits>
+
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+TEST(Float16, Conversion) {
+    // Exactly representable values round-trip.
+    for (float v : {0.0f, 1.0f, -2.5f, 1024.0f, 65504.0f, 0.099975586f}) {
+        EXPECT_EQ(static_cast<float>(Float16(v)), v);
+    }
+    EXPECT_EQ(Float16(1.0f).bits_, 0x3c00);
+    EXPECT_EQ(Float16(-2.0f).bits_, 0xc000);
+    EXPECT_EQ(Float16(-0.0f).bits_, 0x8000);
+
+    // Integers up to 2048 are exact.
+    for (int i = -2048; i <= 2048; ++i) {
+        EXPECT_EQ(static_cast<float>(Float16(static_cast<float>(i))), i);
+    }
+
+    // Round to nearest, ties to even.
+    EXPECT_EQ(static_cast<float>(Float16(2049.0f)), 2048.0f);
+    EXPECT_EQ(static_cast<float>(Float16(2051.0f)), 2052.0f);
+    EXPECT_EQ(static_cast<float>(Float16(1.0f + 1.0f / 4096)), 1.0f);
+
+    // Subnormals.
+    float min_subnormal = std::ldexp(1.0f, -24);
+    EXPECT_EQ(Float16(min_subnormal).bits_, 0x0001);
+    EXPECT_EQ(static_cast<float>(Float16::FromBits(0x0001)), min_subnormal);
+    EXPECT_EQ(static_cast<float>(Float16::FromBits(0x03ff)),
+              std::ldexp(1023.0f, -24));
+    EXPECT_EQ(Float16(min_subnormal / 4).bits_, 0x0000);
+
+    // Overflow, infinity and NaN.
+    EXPECT_EQ(Float16(65520.0f).bits_, 0x7c00);
+    EXPECT_EQ(Float16(-1e10f).bits_, 0xfc00);
+    EXPECT_TRUE(std::isinf(static_cast<float>(
+            Float16(std::numeric_limits<float>::infinity()))));
+    EXPECT_TRUE(std::isnan(static_cast<float>(
+            Float16(std::numeric_limits<float>::quiet_NaN()))));
+
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Float16>::max()),
+              65504.0f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Float16>::lowest()),
+              -65504.0f);
+}
+
+TEST(Float16, Arithmetic) {
+    Float16 a = 1.5f;
+    Float16 b = 2.0f;
+    EXPECT_EQ(static_cast<float>(a + b), 3.5f);
+    EXPECT_EQ(static_cast<float>(a * b), 3.0f);
+    EXPECT_TRUE(a < b);
+    EXPECT_FALSE(a == b);
+    a += b;
+    EXPECT_EQ(static_cast<float>(a), 3.5f);
+    EXPECT_EQ(fmt::format("{}", Float16(0.5f)), "0.5");
+}
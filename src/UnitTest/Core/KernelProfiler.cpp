@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/KernelProfiler.h"
+
+#include <json/json.h>
+#include <sstream>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Tensor.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+TEST(KernelProfiler, Disabled) {
+    KernelProfiler::Disable();
+    KernelProfiler::Clear();
+    Tensor a = Tensor::Ones({2, 3}, Dtype::Float32, Device("CPU:0"));
+    Tensor b = a.Add(a);
+    EXPECT_FALSE(KernelProfiler::IsEnabled());
+    EXPECT_EQ(KernelProfiler::GetEvents().size(), 0);
+}
+
+TEST(KernelProfiler, RecordEvents) {
+    Device device("CPU:0");
+    Tensor a = Tensor::Ones({2, 3}, Dtype::Float32, device);
+    Tensor b = Tensor::Ones({3}, Dtype::Float32, device);
+
+    KernelProfiler::Clear();
+    KernelProfiler::Enable();
+    Tensor c = a.Mul(b);
+    Tensor s = c.Sum({0});
+    Tensor rows = c.IndexGet({Tensor(std::vector<int64_t>{1}, {1},
+                                     Dtype::Int64, device)});
+    KernelProfiler::Disable();
+
+    // Events are ordered by completion. Kernels launched from within other
+    // kernels, such as the Copy initializing the reduction output, complete
+    // before their caller.
+    std::vector<KernelEvent> events;
+    for (const KernelEvent& event : KernelProfiler::GetEvents()) {
+        if (event.name_ != "Copy") {
+            events.push_back(event);
+        }
+    }
+    ASSERT_EQ(events.size(), 3);
+    EXPECT_EQ(events[0].name_, "BinaryEW::Mul");
+    EXPECT_EQ(events[0].dtype_, Dtype::Float32);
+    EXPECT_EQ(events[0].shapes_,
+              std::vector<SizeVector>({{2, 3}, {3}, {2, 3}}));
+    EXPECT_EQ(events[0].bytes_, (6 + 3 + 6) * 4);
+    EXPECT_GE(events[0].duration_us_, 0);
+    EXPECT_GE(events[0].num_threads_, 1);
+    EXPECT_EQ(events[1].name_, "Reduction::Sum");
+    EXPECT_EQ(events[2].name_, "IndexGetRows");
+    EXPECT_LE(events[0].start_us_, events[1].start_us_);
+
+    // The trace is valid JSON in the Chrome trace event format.
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::istringstream trace(KernelProfiler::ToChromeTrace());
+    JSONCPP_STRING errs;
+    ASSERT_TRUE(Json::parseFromStream(builder, trace, &root, &errs));
+    ASSERT_EQ(root["traceEvents"].size(), KernelProfiler::GetEvents().size());
+    EXPECT_EQ(root["traceEvents"][0]["name"].asString(), "BinaryEW::Mul");
+    EXPECT_EQ(root["traceEvents"][0]["ph"].asString(), "X");
+    EXPECT_EQ(root["traceEvents"][0]["args"]["dtype"].asString(), "Float32");
+    EXPECT_EQ(root["traceEvents"][0]["args"]["bytes"].asInt64(), 60);
+    KernelProfiler::Clear();
+}
+
+TEST(KernelProfiler, RingBuffer) {
+    Tensor a = Tensor::Ones({4}, Dtype::Int32, Device("CPU:0"));
+    size_t capacity = KernelProfiler::GetCapacity();
+    KernelProfiler::SetCapacity(2);
+
+    KernelProfiler::Enable();
+    Tensor b = a.Add(a);
+    Tensor c = a.Sub(a);
+    Tensor d = a.Neg();
+    KernelProfiler::Disable();
+
+    // The oldest event is overwritten.
+    std::vector<KernelEvent> events = KernelProfiler::GetEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].name_, "BinaryEW::Sub");
+    EXPECT_EQ(events[1].name_, "UnaryEW::Neg");
+
+    KernelProfiler::SetCapacity(capacity);
+    EXPECT_EQ(KernelProfiler::GetEvents().size(), 0);
+}
@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <vector>
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+// Row-major reference product of an (m, k) and a (k, n) matrix.
+template <typename T>
+static std::vector<T> NaiveMatmul(const std::vector<T>& a,
+                                  const std::vector<T>& b,
+                                  int64_t m,
+                                  int64_t k,
+                                  int64_t n) {
+    std::vector<T> c(m * n, 0);
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t l = 0; l < k; ++l) {
+                c[i * n + j] += a[i * k + l] * b[l * n + j];
+            }
+        }
+    }
+    return c;
+}
+
+// Deterministic values in [-1, 1).
+template <typename T>
+static std::vector<T> MakeValues(int64_t n, int64_t seed) {
+    std::vector<T> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = static_cast<T>(((i + seed) * 7919 % 2001) - 1000) / 1000;
+    }
+    return vals;
+}
+
+// Expects that all elements of a and b differ by at most tol.
+static void ExpectAllNear(const Tensor& a, const Tensor& b, double tol) {
+    ASSERT_EQ(a.GetShape(), b.GetShape());
+    std::vector<double> a_vals = a.To(Dtype::Float64).ToFlatVector<double>();
+    std::vector<double> b_vals = b.To(Dtype::Float64).ToFlatVector<double>();
+    for (size_t i = 0; i < a_vals.size(); ++i) {
+        EXPECT_NEAR(a_vals[i], b_vals[i], tol);
+    }
+}
+
+TEST(LinearAlgebra, Matmul) {
+    Device device("CPU:0");
+    Tensor a(std::vector<int32_t>({1, 2, 3, 4, 5, 6}), {2, 3}, Dtype::Int32,
+             device);
+    Tensor b(std::vector<int32_t>({1, 0, 0, 1, 1, 1}), {3, 2}, Dtype::Int32,
+             device);
+    Tensor c = a.Matmul(b);
+    EXPECT_EQ(c.GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(c.ToFlatVector<int32_t>(), std::vector<int32_t>({4, 5, 10, 11}));
+
+    // Non-contiguous inputs.
+    Tensor c_t = b.T().Matmul(a.T());
+    EXPECT_EQ(c_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({4, 10, 5, 11}));
+
+    EXPECT_THROW(a.Matmul(a), std::runtime_error);
+    EXPECT_THROW(a.Matmul(b.To(Dtype::Float32)), std::runtime_error);
+}
+
+TEST(LinearAlgebra, MatmulLarge) {
+    // Spans several GEMM tiles in every dim.
+    Device device("CPU:0");
+    int64_t m = 70, k = 300, n = 260;
+    std::vector<double> a_vals = MakeValues<double>(m * k, 1);
+    std::vector<double> b_vals = MakeValues<double>(k * n, 2);
+    Tensor a(a_vals, {m, k}, Dtype::Float64, device);
+    Tensor b(b_vals, {k, n}, Dtype::Float64, device);
+    std::vector<double> c_vals = a.Matmul(b).ToFlatVector<double>();
+    std::vector<double> c_ref = NaiveMatmul(a_vals, b_vals, m, k, n);
+    ASSERT_EQ(c_vals.size(), c_ref.size());
+    for (size_t i = 0; i < c_ref.size(); ++i) {
+        EXPECT_NEAR(c_vals[i], c_ref[i], 1e-9);
+    }
+}
+
+TEST(LinearAlgebra, MatmulBatched) {
+    Device device("CPU:0");
+    int64_t batch = 4, m = 2, k = 3, n = 5;
+    std::vector<float> a_vals = MakeValues<float>(batch * m * k, 3);
+    std::vector<float> b_vals = MakeValues<float>(k * n, 4);
+    Tensor a(a_vals, {batch, m, k}, Dtype::Float32, device);
+    Tensor b(b_vals, {k, n}, Dtype::Float32, device);
+
+    // (4, 2, 3) @ (3, 5) -> (4, 2, 5), rhs broadcasted over the batch.
+    Tensor c = a.Matmul(b);
+    EXPECT_EQ(c.GetShape(), SizeVector({batch, m, n}));
+    std::vector<float> c_vals = c.ToFlatVector<float>();
+    for (int64_t i = 0; i < batch; ++i) {
+        std::vector<float> a_i(a_vals.begin() + i * m * k,
+                               a_vals.begin() + (i + 1) * m * k);
+        std::vector<float> c_ref = NaiveMatmul(a_i, b_vals, m, k, n);
+        for (int64_t j = 0; j < m * n; ++j) {
+            EXPECT_NEAR(c_vals[i * m * n + j], c_ref[j], 1e-5);
+        }
+    }
+
+    // (4, 1, 2, 3) @ (3, 3, 5) -> (4, 3, 2, 5).
+    Tensor bb = Tensor::Ones({3, k, n}, Dtype::Float32, device);
+    Tensor cc = a.Reshape({batch, 1, m, k}).Matmul(bb);
+    EXPECT_EQ(cc.GetShape(), SizeVector({batch, 3, m, n}));
+    ExpectAllNear(cc[1][2], a[1].Sum({1}, true).Expand({m, n}), 1e-5);
+}
+
+TEST(LinearAlgebra, Inverse) {
+    Device device("CPU:0");
+    int64_t batch = 10, n = 4;
+    std::vector<double> vals = MakeValues<double>(batch * n * n, 5);
+    for (int64_t b = 0; b < batch; ++b) {
+        for (int64_t i = 0; i < n; ++i) {
+            vals[b * n * n + i * n + i] += 4;
+        }
+    }
+    Tensor a(vals, {batch, n, n}, Dtype::Float64, device);
+    Tensor eye = Tensor::Zeros({n, n}, Dtype::Float64, device);
+    for (int64_t i = 0; i < n; ++i) {
+        eye[i][i] = 1.0;
+    }
+    Tensor a_inv = a.Inverse();
+    EXPECT_EQ(a_inv.GetShape(), a.GetShape());
+    for (int64_t b = 0; b < batch; ++b) {
+        ExpectAllNear(a[b].Matmul(a_inv[b]), eye, 1e-9);
+    }
+
+    // Pivoting is required: the leading entry is 0.
+    Tensor p(std::vector<float>({0, 1, 1, 0}), {2, 2}, Dtype::Float32,
+             device);
+    EXPECT_EQ(p.Inverse().ToFlatVector<float>(),
+              std::vector<float>({0, 1, 1, 0}));
+
+    Tensor singular(std::vector<float>({1, 2, 2, 4}), {2, 2}, Dtype::Float32,
+                    device);
+    EXPECT_THROW(singular.Inverse(), std::runtime_error);
+    EXPECT_THROW(Tensor::Ones({2, 3}, Dtype::Float32, device).Inverse(),
+                 std::runtime_error);
+    EXPECT_THROW(Tensor::Ones({2, 2}, Dtype::Int32, device).Inverse(),
+                 std::runtime_error);
+}
+
+TEST(LinearAlgebra, Solve) {
+    Device device("CPU:0");
+    Tensor a(std::vector<double>({2, 1, 1, 3, 2, 1, 2, 1, 3}), {3, 3},
+             Dtype::Float64, device);
+    Tensor x(std::vector<double>({1, -2, 3}), {3}, Dtype::Float64, device);
+
+    // Vector right-hand side.
+    Tensor b = a.Matmul(x.Reshape({3, 1})).Reshape({3});
+    Tensor x_solved = a.Solve(b);
+    EXPECT_EQ(x_solved.GetShape(), SizeVector({3}));
+    ExpectAllNear(x_solved, x, 1e-9);
+
+    // Batched matrix right-hand side.
+    Tensor xs(MakeValues<double>(2 * 3 * 4, 6), {2, 3, 4}, Dtype::Float64,
+              device);
+    Tensor as = a.Expand({2, 3, 3}).Contiguous();
+    Tensor xs_solved = as.Solve(as.Matmul(xs));
+    EXPECT_EQ(xs_solved.GetShape(), SizeVector({2, 3, 4}));
+    ExpectAllNear(xs_solved, xs, 1e-9);
+
+    EXPECT_THROW(a.Solve(Tensor::Ones({4}, Dtype::Float64, device)),
+                 std::runtime_error);
+}
+
+TEST(LinearAlgebra, SVD) {
+    Device device("CPU:0");
+    int64_t batch = 300;
+    std::vector<float> vals = MakeValues<float>(batch * 9, 7);
+    Tensor a(vals, {batch, 3, 3}, Dtype::Float32, device);
+
+    Tensor u, s, v;
+    std::tie(u, s, v) = a.SVD();
+    EXPECT_EQ(u.GetShape(), SizeVector({batch, 3, 3}));
+    EXPECT_EQ(s.GetShape(), SizeVector({batch, 3}));
+    EXPECT_EQ(v.GetShape(), SizeVector({batch, 3, 3}));
+
+    // A = U diag(S) V^T, with decreasing singular values.
+    Tensor us = u * s.Reshape({batch, 1, 3});
+    for (int64_t b = 0; b < batch; ++b) {
+        ExpectAllNear(us[b].Matmul(v[b].T()), a[b], 1e-4);
+    }
+    std::vector<float> s_vals = s.ToFlatVector<float>();
+    for (int64_t b = 0; b < batch; ++b) {
+        EXPECT_GE(s_vals[b * 3], s_vals[b * 3 + 1]);
+        EXPECT_GE(s_vals[b * 3 + 1], s_vals[b * 3 + 2]);
+        EXPECT_GE(s_vals[b * 3 + 2], 0);
+    }
+
+    EXPECT_THROW(Tensor::Ones({2, 2}, Dtype::Float32, device).SVD(),
+                 std::runtime_error);
+}
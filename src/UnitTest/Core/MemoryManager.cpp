@@ -76,3 +76,47 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     MemoryManager::Free(dst_ptr, dst_device);
     MemoryManager::Free(src_ptr, src_device);
 }
+
+TEST(MemoryManager, CPUCachingReuse) {
+    Device device("CPU:0");
+    std::shared_ptr<CPUCachingMemoryManager> manager =
+            CPUCachingMemoryManager::GetInstance();
+    MemoryManager::ReleaseCache(device);
+    manager->ResetStatistics();
+
+    void* ptr = MemoryManager::Malloc(1000, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+    MemoryManager::Free(ptr, device);
+    EXPECT_GT(manager->GetStatistics().bytes_cached_, 0);
+
+    // 1000 and 1010 bytes fall into the same size class.
+    void* ptr_reused = MemoryManager::Malloc(1010, device);
+    EXPECT_EQ(ptr_reused, ptr);
+    EXPECT_EQ(manager->GetStatistics().num_hits_, 1);
+    EXPECT_EQ(manager->GetStatistics().num_misses_, 1);
+    EXPECT_EQ(manager->GetStatistics().bytes_cached_, 0);
+    MemoryManager::Free(ptr_reused, device);
+
+    MemoryManager::ReleaseCache(device);
+    EXPECT_EQ(manager->GetStatistics().bytes_cached_, 0);
+}
+
+TEST(MemoryManager, CPUCachingMaxBytesCached) {
+    Device device("CPU:0");
+    std::shared_ptr<CPUCachingMemoryManager> manager =
+            CPUCachingMemoryManager::GetInstance();
+    int64_t max_bytes_cached = manager->GetStatistics().max_bytes_cached_;
+    MemoryManager::ReleaseCache(device);
+    manager->ResetStatistics();
+
+    manager->SetMaxBytesCached(0);
+    void* ptr = MemoryManager::Malloc(256, device);
+    MemoryManager::Free(ptr, device);
+    EXPECT_EQ(manager->GetStatistics().bytes_cached_, 0);
+    ptr = MemoryManager::Malloc(256, device);
+    MemoryManager::Free(ptr, device);
+    EXPECT_EQ(manager->GetStatistics().num_hits_, 0);
+    EXPECT_EQ(manager->GetStatistics().num_misses_, 2);
+
+    manager->SetMaxBytesCached(max_bytes_cached);
+}
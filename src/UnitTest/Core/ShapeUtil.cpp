@@ -185,3 +185,17 @@ TEST(ShapeUtil, ReductionShape) {
     EXPECT_EQ(shape_util::ReductionShape({2, 3, 4}, {0, -1}, true),
               SizeVector({1, 3, 1}));
 }
+
+TEST(ShapeUtil, MatmulShape) {
+    EXPECT_EQ(shape_util::MatmulShape({2, 3}, {3, 4}), SizeVector({2, 4}));
+    EXPECT_EQ(shape_util::MatmulShape({5, 2, 3}, {3, 4}),
+              SizeVector({5, 2, 4}));
+    EXPECT_EQ(shape_util::MatmulShape({5, 1, 2, 3}, {6, 3, 4}),
+              SizeVector({5, 6, 2, 4}));
+
+    // Not matrices, inner dims mismatch and incompatible batch dims.
+    EXPECT_THROW(shape_util::MatmulShape({3}, {3, 4}), std::runtime_error);
+    EXPECT_THROW(shape_util::MatmulShape({2, 3}, {2, 4}), std::runtime_error);
+    EXPECT_THROW(shape_util::MatmulShape({5, 2, 3}, {4, 3, 4}),
+                 std::runtime_error);
+}
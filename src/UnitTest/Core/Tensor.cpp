@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <cmath>
+#include <limits>
+#include <numeric>
 
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Dtype.h"
@@ -116,6 +118,47 @@ TEST_P(TensorPermuteDevices, WithInitValueSizeMismatch) {
                  std::runtime_error);
 }
 
+TEST(Tensor, FromEigenVectorView) {
+    std::vector<Eigen::Vector3d> points{{0, 1, 2}, {3, 4, 5}};
+    Tensor t = Tensor::FromEigenVectorView(points);
+    EXPECT_EQ(t.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(t.GetDtype(), Dtype::Float64);
+    EXPECT_EQ(t.GetDataPtr(), points.data());
+    EXPECT_TRUE(t.IsContiguous());
+    EXPECT_EQ(t.Sum({0}).ToFlatVector<double>(),
+              std::vector<double>({3, 5, 7}));
+
+    // Writes go to the vectors in place.
+    t[1][2] = 10.0;
+    t.Slice(1, 0, 1).Mul_(2);
+    EXPECT_EQ(points[1], Eigen::Vector3d(6, 4, 10));
+    EXPECT_EQ(points[0], Eigen::Vector3d(0, 1, 2));
+
+    std::vector<Eigen::Vector3i> triangles{{0, 1, 2}};
+    Tensor t_int = Tensor::FromEigenVectorView(triangles);
+    EXPECT_EQ(t_int.GetShape(), SizeVector({1, 3}));
+    EXPECT_EQ(t_int.GetDtype(), Dtype::Int32);
+
+    std::vector<Eigen::Vector3d> empty;
+    EXPECT_EQ(Tensor::FromEigenVectorView(empty).GetShape(),
+              SizeVector({0, 3}));
+
+    // The keepalive is held until the last Tensor sharing the Blob is gone.
+    auto owner = std::make_shared<std::vector<Eigen::Vector3d>>(points);
+    Tensor t_owned = Tensor::FromEigenVectorView(*owner, owner);
+    std::weak_ptr<std::vector<Eigen::Vector3d>> weak_owner = owner;
+    owner.reset();
+    EXPECT_FALSE(weak_owner.expired());
+    DLManagedTensor* dl_t = t_owned.ToDLPack();
+    t_owned = Tensor();
+    EXPECT_FALSE(weak_owner.expired());
+    Tensor t_from_dl = Tensor::FromDLPack(dl_t);
+    EXPECT_EQ(t_from_dl.ToFlatVector<double>(),
+              std::vector<double>({0, 1, 2, 6, 4, 10}));
+    t_from_dl = Tensor();
+    EXPECT_TRUE(weak_owner.expired());
+}
+
 TEST_P(TensorPermuteDevices, Fill) {
     Device device = GetParam();
     Tensor t(std::vector<float>(2 * 3, 0), {2, 3}, Dtype::Float32, device);
@@ -215,6 +258,54 @@ TEST_P(TensorPermuteDevices, To) {
     EXPECT_EQ(dst_t.ToFlatVector<int>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, SmallDtypes) {
+    Device device = GetParam();
+
+    // A depth image in millimeters.
+    std::vector<uint16_t> depth_vals{0, 1000, 65535, 1500, 2000, 300};
+    Tensor depth(depth_vals, {2, 3}, Dtype::UInt16, device);
+    EXPECT_EQ(depth.ToFlatVector<uint16_t>(), depth_vals);
+    EXPECT_EQ(depth.Max({0, 1}).ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({65535}));
+    EXPECT_EQ(depth.ArgMin({1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2}));
+    // Unsigned arithmetic wraps around like uint16_t.
+    EXPECT_EQ((depth[1] - depth[0]).ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({1500, 1000, 301}));
+    EXPECT_EQ(depth.To(Dtype::Float32).Div(1000).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 65.535f, 1.5f, 2, 0.3f}));
+
+    Tensor offsets(std::vector<int16_t>({-3, 2, -1}), {3}, Dtype::Int16,
+                   device);
+    EXPECT_EQ(offsets.Abs().ToFlatVector<int16_t>(),
+              std::vector<int16_t>({3, 2, 1}));
+    EXPECT_EQ(offsets.Sum({0}).ToFlatVector<int16_t>(),
+              std::vector<int16_t>({-2}));
+    EXPECT_EQ(offsets.Gt(Tensor::Zeros({3}, Dtype::Int16, device))
+                      .ToFlatVector<bool>(),
+              std::vector<bool>({false, true, false}));
+
+    // Float16 is stored in 2 bytes, but computed in float32.
+    Tensor color = Tensor::Full({60000, 3}, 0.5, Dtype::Float16, device);
+    EXPECT_EQ(DtypeUtil::ByteSize(color.GetDtype()), 2);
+    EXPECT_EQ(color[0].ToFlatVector<Float16>()[0].bits_, 0x3800);
+    Tensor color_fma = color.Mul(2).Add(0.25);
+    EXPECT_EQ(color_fma[7].To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({1.25, 1.25, 1.25}));
+    EXPECT_EQ(color.Sqrt().To(Dtype::Float64)[0][0].ToFlatVector<double>(),
+              std::vector<double>({static_cast<float>(Float16(0.70710678f))}));
+
+    // Accumulating in half precision would stall at 1024.
+    EXPECT_EQ(color.Sum({0}).To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({30000, 30000, 30000}));
+    color[5][1] = 3.0;
+    EXPECT_EQ(color.Max({0}).To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.5, 3, 0.5}));
+    EXPECT_EQ(color.ArgMax({0}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 5, 0}));
+    EXPECT_EQ(color[5].ToString(false), "[0.5 3 0.5]");
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     Device dst_device;
     Device src_device;
@@ -597,6 +688,92 @@ TEST_P(TensorPermuteDevices, SetItemAdvancedIndexingMixed) {
                                   16, 200, 400, 19, 20, 21,  22,  23}));
 }
 
+TEST_P(TensorPermuteDevices, NonZero) {
+    Device device = GetParam();
+
+    Tensor t(std::vector<float>{0, 1.5, 0, -2, 0, 3}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor non_zero = t.NonZero();
+    EXPECT_EQ(non_zero.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(non_zero.GetDtype(), Dtype::Int64);
+    EXPECT_EQ(non_zero.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 1, 1, 0, 2}));
+
+    std::vector<Tensor> non_zero_numpy = t.T().NonZeroNumpy();
+    EXPECT_EQ(non_zero_numpy.size(), 2);
+    EXPECT_EQ(non_zero_numpy[0].ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2}));
+    EXPECT_EQ(non_zero_numpy[1].ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, 1}));
+
+    // Spans several compaction chunks.
+    int64_t size = 100000;
+    std::vector<int32_t> vals(size, 0);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < size; i += 7) {
+        vals[i] = 1;
+        expected.push_back(i);
+    }
+    Tensor large(vals, {size}, Dtype::Int32, device);
+    EXPECT_EQ(large.NonZero().ToFlatVector<int64_t>(), expected);
+    EXPECT_EQ(Tensor::Zeros({4, 5}, Dtype::Bool, device).NonZero().GetShape(),
+              SizeVector({2, 0}));
+}
+
+TEST_P(TensorPermuteDevices, IndexGetBoolMask) {
+    Device device = GetParam();
+
+    // Filter points by depth range.
+    Tensor points(std::vector<float>{0, 0, 0.5, 1, 1, 2.5, 2, 2, 1.5, 3, 3, 4},
+                  {4, 3}, Dtype::Float32, device);
+    Tensor depth = points.Slice(1, 2, 3).Reshape({4});
+    Tensor mask = depth.Gt(Tensor::Full({}, 1.0, Dtype::Float32, device))
+                          .LogicalAnd(depth.Lt(Tensor::Full(
+                                  {}, 3.0, Dtype::Float32, device)));
+    Tensor selected = points.IndexGet({mask});
+    EXPECT_EQ(selected.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(selected.ToFlatVector<float>(),
+              std::vector<float>({1, 1, 2.5, 2, 2, 1.5}));
+    EXPECT_EQ(points.GetItem(TensorKey::IndexTensor(mask)).GetShape(),
+              SizeVector({2, 3}));
+
+    // A multi-dimensional mask selects elements.
+    Tensor elements = points.IndexGet({points.Gt(Tensor::Full(
+            {}, 2.0, Dtype::Float32, device))});
+    EXPECT_EQ(elements.ToFlatVector<float>(),
+              std::vector<float>({2.5, 3, 3, 4}));
+
+    // A mask after a full slice.
+    Tensor columns = points.GetItem(
+            {TensorKey::Slice(None, None, None),
+             TensorKey::IndexTensor(Tensor(std::vector<bool>{true, false, true},
+                                           {3}, Dtype::Bool, device))});
+    EXPECT_EQ(columns.ToFlatVector<float>(),
+              std::vector<float>({0, 0.5, 1, 2.5, 2, 1.5, 3, 4}));
+
+    EXPECT_THROW(points.IndexGet({Tensor::Ones({3}, Dtype::Bool, device)}),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, SetItemBoolMask) {
+    Device device = GetParam();
+
+    Tensor t(std::vector<int32_t>{5, -1, 3, -7, 0, -2}, {2, 3}, Dtype::Int32,
+             device);
+    Tensor mask = t.Lt(Tensor::Zeros({}, Dtype::Int32, device));
+    t.SetItem(TensorKey::IndexTensor(mask),
+              Tensor(std::vector<int32_t>{0}, {1}, Dtype::Int32, device));
+    EXPECT_EQ(t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 0, 3, 0, 0, 0}));
+
+    // Rows selected by a mask take the row scatter path.
+    Tensor rows(std::vector<bool>{false, true}, {2}, Dtype::Bool, device);
+    t.IndexSet({rows}, Tensor(std::vector<int32_t>{7, 8, 9}, {1, 3},
+                              Dtype::Int32, device));
+    EXPECT_EQ(t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 0, 3, 7, 8, 9}));
+}
+
 TEST_P(TensorPermuteDevices, SliceAssign) {
     Device device = GetParam();
 
@@ -729,6 +906,107 @@ TEST_P(TensorPermuteDevicePairs, IndexGetNegative) {
     EXPECT_EQ(t_1.ToFlatVector<float>(), std::vector<float>({5, 10, 17, 22}));
 }
 
+TEST_P(TensorPermuteDevicePairs, IndexGetRows) {
+    Device idx_device;
+    Device src_device;
+    std::tie(idx_device, src_device) = GetParam();
+
+    std::vector<float> vals{0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11,
+                            12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23};
+    Tensor src_t(vals, {4, 3, 2}, Dtype::Float32, src_device);
+
+    // t[[3, 0, -1, 1]]
+    Tensor index(std::vector<int64_t>({3, 0, -1, 1}), {4}, Dtype::Int64,
+                 idx_device);
+    Tensor dst_t = src_t.IndexGet({index});
+    EXPECT_TRUE(dst_t.IsContiguous());
+    EXPECT_EQ(dst_t.GetShape(), SizeVector({4, 3, 2}));
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({18, 19, 20, 21, 22, 23, 0,  1,
+                                  2,  3,  4,  5,  18, 19, 20, 21,
+                                  22, 23, 6,  7,  8,  9,  10, 11}));
+
+    // Points of a single coordinate are also gathered by rows.
+    Tensor ids(std::vector<int64_t>({2, 2, 0}), {3}, Dtype::Int64,
+               idx_device);
+    EXPECT_EQ(src_t.Reshape({24}).IndexGet({ids}).ToFlatVector<float>(),
+              std::vector<float>({2, 2, 0}));
+    EXPECT_EQ(src_t.IndexGet({ids.Slice(0, 0, 0)}).GetShape(),
+              SizeVector({0, 3, 2}));
+
+    Tensor out_of_bounds(std::vector<int64_t>({4}), {1}, Dtype::Int64,
+                         idx_device);
+    if (idx_device == src_device &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        EXPECT_THROW(src_t.IndexGet({out_of_bounds}), std::runtime_error);
+    }
+}
+
+TEST_P(TensorPermuteDevicePairs, IndexSetRows) {
+    Device idx_device;
+    Device dst_device;
+    std::tie(idx_device, dst_device) = GetParam();
+
+    Tensor dst_t = Tensor::Zeros({4, 2}, Dtype::Int32, dst_device);
+    Tensor src_t(std::vector<int32_t>({1, 2, 3, 4}), {2, 2}, Dtype::Int32,
+                 dst_device);
+
+    // t[[2, -4]] = src
+    Tensor index(std::vector<int64_t>({2, -4}), {2}, Dtype::Int64,
+                 idx_device);
+    dst_t.IndexSet({index}, src_t);
+    EXPECT_EQ(dst_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 4, 0, 0, 1, 2, 0, 0}));
+
+    // A broadcasted value takes the generic advanced indexing path.
+    dst_t.IndexSet({index}, Tensor(std::vector<int32_t>({7}), {1},
+                                   Dtype::Int32, dst_device));
+    EXPECT_EQ(dst_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({7, 7, 0, 0, 7, 7, 0, 0}));
+}
+
+TEST(Tensor, IndexAdd) {
+    Device device("CPU:0");
+
+    // Duplicated indices accumulate.
+    Tensor dst_t = Tensor::Ones({3, 2}, Dtype::Float32, device);
+    Tensor src_t(std::vector<float>({1, 2, 3, 4, 5, 6, 7, 8}), {4, 2},
+                 Dtype::Float32, device);
+    Tensor index(std::vector<int64_t>({0, 2, 0, -1}), {4}, Dtype::Int64,
+                 device);
+    dst_t.IndexAdd_(0, index, src_t);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({7, 9, 1, 1, 11, 13}));
+
+    // Along an inner dimension of a non-contiguous tensor.
+    Tensor dst_2d = Tensor::Zeros({3, 2}, Dtype::Int64, device).T();
+    Tensor src_2d(std::vector<int64_t>({1, 2, 3, 4}), {2, 2}, Dtype::Int64,
+                  device);
+    dst_2d.IndexAdd_(1, Tensor(std::vector<int64_t>({2, 2}), {2},
+                               Dtype::Int64, device),
+                     src_2d);
+    EXPECT_EQ(dst_2d.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0, 3, 0, 0, 7}));
+
+    // Large enough to split the destination rows across threads.
+    int64_t num_points = 100000;
+    Tensor sums = Tensor::Zeros({10, 3}, Dtype::Float64, device);
+    std::vector<int64_t> labels(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        labels[i] = i % 10;
+    }
+    sums.IndexAdd_(0, Tensor(labels, {num_points}, Dtype::Int64, device),
+                   Tensor::Ones({num_points, 3}, Dtype::Float64, device));
+    EXPECT_EQ(sums.ToFlatVector<double>(), std::vector<double>(30, 10000));
+
+    EXPECT_THROW(dst_t.IndexAdd_(0, index, dst_t), std::runtime_error);
+    EXPECT_THROW(dst_t.IndexAdd_(0,
+                                 Tensor(std::vector<int64_t>({0, 3}), {2},
+                                        Dtype::Int64, device),
+                                 src_t.Slice(0, 0, 2)),
+                 std::runtime_error);
+}
+
 TEST_P(TensorPermuteDevicePairs, IndexGet2DBroadcastedIndex) {
     Device idx_device;
     Device src_device;
@@ -1060,6 +1338,38 @@ TEST_P(TensorPermuteDevices, Add_BroadcastException) {
                                   20, 22, 24, 26, 28, 30, 32, 34}));
 }
 
+TEST_P(TensorPermuteDevices, AddContiguousScalarAndStrided) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}), {3, 4},
+             Dtype::Float32, device);
+
+    // Contiguous + broadcasted scalar, both operand orders.
+    Tensor b = Tensor::Full({}, 10, Dtype::Float32, device);
+    EXPECT_EQ((a + b).ToFlatVector<float>(),
+              std::vector<float>(
+                      {10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21}));
+    EXPECT_EQ((b - a).ToFlatVector<float>(),
+              std::vector<float>({10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1}));
+
+    // Broadcasted row is neither contiguous nor scalar.
+    Tensor row(std::vector<float>({100, 200, 300, 400}), {4}, Dtype::Float32,
+               device);
+    EXPECT_EQ((a + row).ToFlatVector<float>(),
+              std::vector<float>({100, 201, 302, 403, 104, 205, 306, 407, 108,
+                                  209, 310, 411}));
+
+    // Strided input and strided output.
+    Tensor a_t = a.T();
+    EXPECT_EQ((a_t * 2).ToFlatVector<float>(),
+              std::vector<float>({0, 8, 16, 2, 10, 18, 4, 12, 20, 6, 14, 22}));
+    Tensor dst = Tensor::Zeros({4, 6}, Dtype::Float32, device);
+    Tensor dst_slice = dst.Slice(1, 0, 6, 2);
+    dst_slice.Add_(a_t);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 0, 4, 0, 8, 0, 1, 0, 5, 0, 9, 0,
+                                  2, 0, 6, 0, 10, 0, 3, 0, 7, 0, 11, 0}));
+}
+
 TEST_P(TensorPermuteDevices, Sub) {
     Device device = GetParam();
     Tensor a(std::vector<float>({10, 12, 14, 16, 18, 20}), {2, 3},
@@ -1609,6 +1919,55 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceParallel) {
+    Device device = GetParam();
+
+    // Large enough to be split among threads.
+    int64_t n = 100000;
+    std::vector<int64_t> vals(n * 3);
+    for (int64_t i = 0; i < n * 3; ++i) {
+        vals[i] = (i * 7919) % 1000 - 500;
+    }
+    Tensor src(vals, {n, 3}, Dtype::Int64, device);
+
+    // Few outputs along the inner dim: (N, 3) -> (3).
+    std::vector<int64_t> col_sums(3, 0);
+    std::vector<int64_t> col_maxs(3, std::numeric_limits<int64_t>::lowest());
+    std::vector<int64_t> row_sums(n, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            col_sums[j] += vals[i * 3 + j];
+            col_maxs[j] = std::max(col_maxs[j], vals[i * 3 + j]);
+            row_sums[i] += vals[i * 3 + j];
+        }
+    }
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<int64_t>(), col_sums);
+    EXPECT_EQ(src.Max({0}).ToFlatVector<int64_t>(), col_maxs);
+
+    // Many outputs: (N, 3) -> (N), and the transposed (3, N) -> (N).
+    EXPECT_EQ(src.Sum({1}).ToFlatVector<int64_t>(), row_sums);
+    EXPECT_EQ(src.T().Sum({0}).ToFlatVector<int64_t>(), row_sums);
+
+    // Single output.
+    int64_t total = std::accumulate(vals.begin(), vals.end(), int64_t(0));
+    EXPECT_EQ(src.Sum({0, 1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({total}));
+
+    // Max of negative floats.
+    Tensor neg = Tensor::Full({n}, -2.5f, Dtype::Float32, device);
+    EXPECT_EQ(neg.Max({0}).ToFlatVector<float>(), std::vector<float>({-2.5f}));
+
+    // Arg-reductions with ties resolve to the first index.
+    std::vector<float> arg_vals(n, 0);
+    arg_vals[n / 3] = 1;
+    arg_vals[n / 2] = 1;
+    Tensor arg_src(arg_vals, {n}, Dtype::Float32, device);
+    EXPECT_EQ(arg_src.ArgMax({0}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({n / 3}));
+    EXPECT_EQ(arg_src.ArgMin({0}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0}));
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     Device device = GetParam();
     Tensor src(std::vector<float>({0, 1, 4, 9, 16, 25}), {2, 3}, Dtype::Float32,
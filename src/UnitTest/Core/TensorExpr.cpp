@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/TensorExpr.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+#include <vector>
+
+using namespace std;
+using namespace open3d;
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, Arithmetic) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({5, 4, 3, 2, 1, 0}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor c(std::vector<float>({1, 2, 3}), {3}, Dtype::Float32, device);
+    Tensor d = Tensor::Ones({2, 3}, Dtype::Float32, device);
+
+    TensorExpr expr = (TensorExpr(a) - b) * c + d;
+    EXPECT_EQ(expr.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(expr.GetDtype(), Dtype::Float32);
+    EXPECT_EQ(expr.Eval().ToFlatVector<float>(),
+              ((a - b) * c + d).ToFlatVector<float>());
+
+    // Scalars and repeated operands.
+    EXPECT_EQ(((TensorExpr(a) + a) / 2.f - 1.f).Eval().ToFlatVector<float>(),
+              std::vector<float>({-1, 0, 1, 2, 3, 4}));
+    EXPECT_EQ((10.f - TensorExpr(a)).Eval().ToFlatVector<float>(),
+              std::vector<float>({10, 9, 8, 7, 6, 5}));
+
+    // Transcendental ops.
+    Tensor e(std::vector<double>({1, 4, 9, 16}), {4}, Dtype::Float64, device);
+    EXPECT_EQ((-TensorExpr(e)).Abs().Sqrt().Eval().ToFlatVector<double>(),
+              std::vector<double>({1, 2, 3, 4}));
+    EXPECT_EQ(TensorExpr(e).Exp().Eval().ToFlatVector<double>(),
+              e.Exp().ToFlatVector<double>());
+}
+
+TEST_P(TensorExprPermuteDevices, Comparison) {
+    Device device = GetParam();
+    Tensor a(std::vector<int32_t>({0, 1, 2, 3, 4, 5}), {6}, Dtype::Int32,
+             device);
+    Tensor b(std::vector<int32_t>({5, 4, 3, 2, 1, 0}), {6}, Dtype::Int32,
+             device);
+
+    Tensor dst = (TensorExpr(a) > b).Eval();
+    EXPECT_EQ(dst.GetDtype(), Dtype::Bool);
+    EXPECT_EQ(dst.ToFlatVector<bool>(),
+              std::vector<bool>({false, false, false, true, true, true}));
+
+    Tensor five = Tensor::Full({}, 5, Dtype::Int32, device);
+    dst = ((TensorExpr(a) * 2).Ge(b).LogicalAnd(TensorExpr(a) != five))
+                  .Eval();
+    EXPECT_EQ(dst.ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true, true, true, false}));
+}
+
+TEST_P(TensorExprPermuteDevices, StridedAndBroadcasted) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}), {3, 4},
+             Dtype::Float32, device);
+    Tensor a_t = a.T();
+    Tensor col(std::vector<float>({100, 200, 300}), {3}, Dtype::Float32,
+               device);
+
+    // Transposed input, broadcasted row and scalar; > 1 tile of elements.
+    EXPECT_EQ(((TensorExpr(a_t) + col) * 2.f).Eval().ToFlatVector<float>(),
+              ((a_t + col) * 2.f).ToFlatVector<float>());
+
+    Tensor large = Tensor::Ones({1000, 3}, Dtype::Float32, device);
+    Tensor offset(std::vector<float>({1, 2, 3}), {3}, Dtype::Float32, device);
+    Tensor large_dst = (TensorExpr(large) * offset - 1.f).Eval();
+    EXPECT_EQ(large_dst.ToFlatVector<float>(),
+              (large * offset - 1.f).ToFlatVector<float>());
+}
+
+TEST_P(TensorExprPermuteDevices, ManyInputs) {
+    Device device = GetParam();
+    // More inputs than an Indexer supports.
+    TensorExpr expr = Tensor::Zeros({2}, Dtype::Int64, device);
+    for (int64_t i = 1; i <= 12; ++i) {
+        expr = expr + Tensor::Full({2}, i, Dtype::Int64, device);
+    }
+    EXPECT_EQ(expr.Eval().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({78, 78}));
+}
+
+TEST_P(TensorExprPermuteDevices, Exceptions) {
+    Device device = GetParam();
+    Tensor a = Tensor::Ones({2, 3}, Dtype::Float32, device);
+    Tensor b = Tensor::Ones({2}, Dtype::Float32, device);
+    Tensor c = Tensor::Ones({2, 3}, Dtype::Int32, device);
+
+    EXPECT_THROW(TensorExpr(a) + b, std::runtime_error);
+    EXPECT_THROW(TensorExpr(a) + c, std::runtime_error);
+    EXPECT_THROW(TensorExpr(c).Sqrt(), std::runtime_error);
+}
@@ -0,0 +1,218 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <set>
+
+#include "Open3D/Geometry/KDTreeDynamic.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Brute-force neighbors among the points that are still in the tree.
+vector<pair<double, int>> BruteForce(const vector<Vector3d> &points,
+                                     const set<int> &alive,
+                                     const Vector3d &query) {
+    vector<pair<double, int>> neighbors;
+    for (int id : alive) {
+        neighbors.emplace_back((points[id] - query).squaredNorm(), id);
+    }
+    sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+}  // unnamed namespace
+
+TEST(KDTreeDynamic, AddRemoveSearch) {
+    geometry::KDTreeDynamic3D kdtree(8);
+    vector<Vector3d> points;
+    set<int> alive;
+
+    vector<Vector3d> queries(50);
+    Rand(queries, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 100);
+
+    for (int frame = 0; frame < 12; frame++) {
+        vector<Vector3d> frame_points(100 + 37 * frame);
+        Rand(frame_points, Vector3d(0.0, 0.0, 0.0),
+             Vector3d(10.0, 10.0, 10.0), frame);
+        EXPECT_TRUE(kdtree.AddPoints(frame_points));
+        for (const Vector3d &point : frame_points) {
+            alive.insert(int(points.size()));
+            points.push_back(point);
+        }
+
+        // Remove every third point of the previous frames, and some ids
+        // twice or out of range.
+        vector<int> to_remove = {-1, int(points.size()) + 10};
+        int expected = 0;
+        for (int id = frame; id < int(points.size()); id += 3) {
+            if (alive.count(id)) {
+                expected++;
+                alive.erase(id);
+            }
+            to_remove.push_back(id);
+        }
+        EXPECT_EQ(kdtree.RemovePoints(to_remove), expected);
+        EXPECT_EQ(kdtree.GetDataSize(), alive.size());
+        // The forest has at most one tree per power of two.
+        EXPECT_LE(kdtree.GetTreeCount(), size_t(12));
+
+        vector<int> indices;
+        vector<double> distance2;
+        for (const Vector3d &query : queries) {
+            vector<pair<double, int>> ref = BruteForce(points, alive, query);
+
+            int k = kdtree.SearchKNN(query, 5, indices, distance2);
+            ASSERT_EQ(k, 5);
+            for (int j = 0; j < k; j++) {
+                EXPECT_NEAR(distance2[j], ref[j].first, 1e-4);
+                EXPECT_TRUE(alive.count(indices[j]) > 0);
+            }
+
+            k = kdtree.SearchRadius(query, 1.0, indices, distance2);
+            int num_ref = int(count_if(
+                    ref.begin(), ref.end(),
+                    [](const pair<double, int> &n) { return n.first < 1.0; }));
+            EXPECT_NEAR(k, num_ref, 1);
+            for (int j = 0; j < k; j++) {
+                EXPECT_TRUE(alive.count(indices[j]) > 0);
+                EXPECT_NEAR(distance2[j],
+                            (points[indices[j]] - query).squaredNorm(), 1e-4);
+            }
+
+            k = kdtree.SearchHybrid(query, 1.0, 3, indices, distance2);
+            EXPECT_EQ(k, min(3, num_ref));
+        }
+    }
+
+    const int id = *alive.begin();
+    EXPECT_TRUE(kdtree.HasPoint(id));
+    EXPECT_FALSE(kdtree.HasPoint(0));
+    EXPECT_FALSE(kdtree.HasPoint(int(points.size())));
+    ExpectEQ(kdtree.GetPoint(id), points[id], 1e-5);
+
+    // Zero neighbors requested, like KDTreeFlann.
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(kdtree.SearchKNN(queries[0], 0, indices, distance2), 0);
+    EXPECT_TRUE(indices.empty());
+    EXPECT_TRUE(distance2.empty());
+    EXPECT_EQ(kdtree.SearchHybrid(queries[0], 1.0, 0, indices, distance2), 0);
+    EXPECT_TRUE(indices.empty());
+    vector<size_t> offsets;
+    EXPECT_TRUE(kdtree.SearchBatch(queries, geometry::KDTreeSearchParamKNN(0),
+                                   indices, distance2, offsets));
+    EXPECT_EQ(offsets.back(), size_t(0));
+    EXPECT_EQ(kdtree.SearchRadius(queries[0], 0.0, indices, distance2), -1);
+}
+
+TEST(KDTreeDynamic, Compact) {
+    geometry::KDTreeDynamic3D kdtree(8);
+    vector<Vector3d> points(1000);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    kdtree.AddPoints(points);
+    // Few enough removals that the removed points stay in the tree.
+    vector<int> to_remove;
+    for (int id = 0; id < int(points.size()); id += 4) {
+        to_remove.push_back(id);
+    }
+    kdtree.RemovePoints(to_remove);
+    EXPECT_THROW(kdtree.GetPoint(0), std::runtime_error);
+
+    vector<int> new_ids = kdtree.Compact();
+    ASSERT_EQ(new_ids.size(), points.size());
+    vector<Vector3d> compacted;
+    for (int id = 0; id < int(points.size()); id++) {
+        if (id % 4 == 0) {
+            EXPECT_EQ(new_ids[id], -1);
+        } else {
+            EXPECT_EQ(new_ids[id], int(compacted.size()));
+            compacted.push_back(points[id]);
+        }
+    }
+    EXPECT_EQ(kdtree.GetDataSize(), compacted.size());
+    EXPECT_FALSE(kdtree.HasPoint(int(compacted.size())));
+    for (int id = 0; id < int(compacted.size()); id++) {
+        ExpectEQ(kdtree.GetPoint(id), compacted[id], 1e-5);
+    }
+
+    // New points get the ids following the compacted ones, and are merged
+    // with the compacted tree.
+    vector<Vector3d> more(600);
+    Rand(more, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 1);
+    kdtree.AddPoints(more);
+    compacted.insert(compacted.end(), more.begin(), more.end());
+    set<int> alive;
+    for (int id = 0; id < int(compacted.size()); id++) {
+        alive.insert(id);
+    }
+    vector<int> indices;
+    vector<double> distance2;
+    for (const Vector3d &query : more) {
+        vector<pair<double, int>> ref = BruteForce(compacted, alive, query);
+        ASSERT_EQ(kdtree.SearchKNN(query, 3, indices, distance2), 3);
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(distance2[j], ref[j].first, 1e-4);
+            EXPECT_NEAR(distance2[j],
+                        (compacted[indices[j]] - query).squaredNorm(), 1e-4);
+        }
+    }
+}
+
+TEST(KDTreeDynamic, SearchBatch) {
+    geometry::KDTreeDynamic3D kdtree;
+    vector<Vector3d> points(500);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    kdtree.AddPoints(vector<Vector3d>(points.begin(), points.begin() + 300));
+    kdtree.AddPoints(vector<Vector3d>(points.begin() + 300, points.end()));
+    kdtree.RemovePoints({0, 1, 2, 350});
+
+    geometry::KDTreeSearchParamKNN param(4);
+    vector<int> indices;
+    vector<double> distance2;
+    vector<size_t> offsets;
+    EXPECT_TRUE(kdtree.SearchBatch(points, param, indices, distance2,
+                                   offsets));
+    ASSERT_EQ(offsets.size(), points.size() + 1);
+    for (size_t i = 0; i < points.size(); i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        kdtree.Search(points[i], param, ref_indices, ref_distance2);
+        ASSERT_EQ(offsets[i + 1] - offsets[i], ref_indices.size());
+        for (size_t j = 0; j < ref_indices.size(); j++) {
+            EXPECT_EQ(ref_indices[j], indices[offsets[i] + j]);
+        }
+    }
+
+    EXPECT_FALSE(kdtree.AddPoints(MatrixXd::Zero(2, 3)));
+    kdtree.Clear();
+    EXPECT_EQ(kdtree.SearchKNN(Vector3d::Zero(), 1, indices, distance2), -1);
+}
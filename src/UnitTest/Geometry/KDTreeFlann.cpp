@@ -144,3 +144,110 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_indices, indices);
     ExpectEQ(ref_distance2, distance2);
 }
+
+// Checks that the CSR output of a batched search matches one single search per
+// query, for every supported search type.
+TEST(KDTreeFlann, SearchBatch) {
+    int size = 1000;
+    int num_queries = 600;
+
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> queries(num_queries);
+    Rand(queries, Vector3d(-1.0, -1.0, -1.0), Vector3d(11.0, 11.0, 11.0), 1);
+
+    geometry::KDTreeSearchParamKNN knn_param(7);
+    geometry::KDTreeSearchParamRadius radius_param(1.5);
+    geometry::KDTreeSearchParamHybrid hybrid_param(1.5, 5);
+    geometry::KDTreeSearchParamHybrid nearest_param(0.5, 1);
+    vector<const geometry::KDTreeSearchParam *> params = {
+            &knn_param, &radius_param, &hybrid_param, &nearest_param};
+    for (const geometry::KDTreeSearchParam *param : params) {
+        vector<int> indices;
+        vector<double> distance2;
+        vector<size_t> offsets;
+        EXPECT_TRUE(kdtree.SearchBatch(queries, *param, indices, distance2,
+                                       offsets));
+        ASSERT_EQ(offsets.size(), size_t(num_queries + 1));
+        EXPECT_EQ(offsets.back(), indices.size());
+        EXPECT_EQ(offsets.back(), distance2.size());
+
+        for (int i = 0; i < num_queries; i++) {
+            vector<int> ref_indices;
+            vector<double> ref_distance2;
+            int k = kdtree.Search(queries[i], *param, ref_indices,
+                                  ref_distance2);
+            ASSERT_EQ(size_t(k), offsets[i + 1] - offsets[i]);
+            for (int j = 0; j < k; j++) {
+                EXPECT_EQ(ref_indices[j], indices[offsets[i] + j]);
+                EXPECT_NEAR(ref_distance2[j], distance2[offsets[i] + j],
+                            THRESHOLD_1E_6);
+            }
+        }
+    }
+}
+
+TEST(KDTreeFlann, SearchBatchMatrix) {
+    Eigen::MatrixXd data = Eigen::MatrixXd::Random(8, 300);
+    Eigen::MatrixXd queries = Eigen::MatrixXd::Random(8, 40);
+    geometry::KDTreeFlann kdtree(data);
+
+    vector<int> indices;
+    vector<double> distance2;
+    vector<size_t> offsets;
+    EXPECT_TRUE(kdtree.SearchKNNBatch(queries, 3, indices, distance2,
+                                      offsets));
+    ASSERT_EQ(indices.size(), size_t(40 * 3));
+    for (int i = 0; i < 40; i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        Eigen::VectorXd query = queries.col(i);
+        kdtree.SearchKNN(query, 3, ref_indices, ref_distance2);
+        EXPECT_EQ(offsets[i], size_t(i * 3));
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(ref_indices[j], indices[i * 3 + j]);
+        }
+    }
+
+    // More neighbors than points are clamped to the size of the tree.
+    EXPECT_TRUE(kdtree.SearchKNNBatch(queries, 500, indices, distance2,
+                                      offsets));
+    EXPECT_EQ(offsets[1], size_t(300));
+    EXPECT_EQ(indices.size(), size_t(40 * 300));
+
+    // Query dimension must match the tree.
+    Eigen::MatrixXd wrong_queries = Eigen::MatrixXd::Random(3, 5);
+    EXPECT_FALSE(kdtree.SearchRadiusBatch(wrong_queries, 1.0, indices,
+                                          distance2, offsets));
+    EXPECT_FALSE(kdtree.SearchHybridBatch(queries, 1.0, -1, indices,
+                                          distance2, offsets));
+}
+
+TEST(KDTreeFlann, ApproximateSearch) {
+    Eigen::MatrixXd data = Eigen::MatrixXd::Random(33, 2000);
+    Eigen::MatrixXd queries = Eigen::MatrixXd::Random(33, 200);
+    geometry::KDTreeFlann exact_kdtree(data);
+    geometry::KDTreeIndexParam index_param(4, 512);
+    EXPECT_TRUE(index_param.IsApproximate());
+    geometry::KDTreeFlann kdtree(data, index_param);
+
+    vector<int> ref_indices, indices;
+    vector<double> ref_distance2, distance2;
+    vector<size_t> ref_offsets, offsets;
+    exact_kdtree.SearchKNNBatch(queries, 1, ref_indices, ref_distance2,
+                                ref_offsets);
+    kdtree.SearchKNNBatch(queries, 1, indices, distance2, offsets);
+    ASSERT_EQ(indices.size(), size_t(200));
+
+    // Approximate neighbors are never closer than the exact ones, and most
+    // of them are the exact ones.
+    int num_exact = 0;
+    for (int i = 0; i < 200; i++) {
+        EXPECT_GE(distance2[i], ref_distance2[i] - THRESHOLD_1E_6);
+        num_exact += indices[i] == ref_indices[i];
+    }
+    EXPECT_GE(num_exact, 100);
+}
@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/KDTreeFloat.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Compares the results of both trees by distance, since single precision may
+// swap the order of neighbors at almost the same distance.
+void ExpectSameNeighbors(const vector<Vector3d> &points,
+                         const Vector3d &query,
+                         int k_ref,
+                         const vector<double> &ref_distance2,
+                         int k,
+                         const vector<int> &indices,
+                         const vector<double> &distance2) {
+    ASSERT_EQ(k_ref, k);
+    for (int j = 0; j < k; j++) {
+        EXPECT_NEAR(ref_distance2[j], distance2[j], 1e-4);
+        EXPECT_NEAR((points[indices[j]] - query).squaredNorm(), distance2[j],
+                    1e-4);
+        if (j > 0) {
+            EXPECT_LE(distance2[j - 1], distance2[j]);
+        }
+    }
+}
+
+}  // unnamed namespace
+
+TEST(KDTreeFloat, MatchesKDTreeFlann) {
+    geometry::PointCloud pc;
+    pc.points_.resize(2000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree_ref(pc);
+    geometry::KDTreeFloat3D kdtree(pc);
+    EXPECT_EQ(kdtree.GetDataSize(), size_t(2000));
+
+    vector<Vector3d> queries(200);
+    Rand(queries, Vector3d(-1.0, -1.0, -1.0), Vector3d(11.0, 11.0, 11.0), 1);
+
+    vector<int> ref_indices, indices;
+    vector<double> ref_distance2, distance2;
+    for (const Vector3d &query : queries) {
+        int k_ref = kdtree_ref.SearchKNN(query, 10, ref_indices, ref_distance2);
+        int k = kdtree.SearchKNN(query, 10, indices, distance2);
+        ExpectSameNeighbors(pc.points_, query, k_ref, ref_distance2, k,
+                            indices, distance2);
+
+        k_ref = kdtree_ref.SearchRadius(query, 0.9, ref_indices,
+                                        ref_distance2);
+        k = kdtree.SearchRadius(query, 0.9, indices, distance2);
+        ExpectSameNeighbors(pc.points_, query, k_ref, ref_distance2, k,
+                            indices, distance2);
+
+        k_ref = kdtree_ref.SearchHybrid(query, 0.9, 5, ref_indices,
+                                        ref_distance2);
+        k = kdtree.SearchHybrid(query, 0.9, 5, indices, distance2);
+        ExpectSameNeighbors(pc.points_, query, k_ref, ref_distance2, k,
+                            indices, distance2);
+    }
+}
+
+TEST(KDTreeFloat, SearchBatch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFloat3D kdtree(pc, 8);
+
+    vector<Vector3d> queries(600);
+    Rand(queries, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 1);
+
+    geometry::KDTreeSearchParamHybrid param(1.5, 7);
+    vector<int> indices;
+    vector<double> distance2;
+    vector<size_t> offsets;
+    EXPECT_TRUE(kdtree.SearchBatch(queries, param, indices, distance2,
+                                   offsets));
+    ASSERT_EQ(offsets.size(), queries.size() + 1);
+    EXPECT_EQ(offsets.back(), indices.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        vector<int> ref_indices;
+        vector<double> ref_distance2;
+        int k = kdtree.Search(queries[i], param, ref_indices, ref_distance2);
+        ASSERT_EQ(size_t(k), offsets[i + 1] - offsets[i]);
+        for (int j = 0; j < k; j++) {
+            EXPECT_EQ(ref_indices[j], indices[offsets[i] + j]);
+            EXPECT_EQ(ref_distance2[j], distance2[offsets[i] + j]);
+        }
+    }
+
+    // Invalid parameters are rejected before any query is searched.
+    EXPECT_FALSE(kdtree.SearchBatch(queries, geometry::KDTreeSearchParamKNN(-1),
+                                    indices, distance2, offsets));
+    EXPECT_FALSE(kdtree.SearchBatch(queries,
+                                    geometry::KDTreeSearchParamRadius(0.0),
+                                    indices, distance2, offsets));
+    EXPECT_FALSE(kdtree.SearchBatch(queries,
+                                    geometry::KDTreeSearchParamHybrid(1.0, -1),
+                                    indices, distance2, offsets));
+}
+
+TEST(KDTreeFloat, Degenerate) {
+    vector<int> indices;
+    vector<double> distance2;
+
+    // Empty tree and mismatched dimension.
+    geometry::KDTreeFloat3D empty_tree;
+    EXPECT_EQ(empty_tree.SearchKNN(Vector3d::Zero(), 1, indices, distance2),
+              -1);
+    EXPECT_FALSE(empty_tree.SetMatrixData(MatrixXd::Zero(2, 10)));
+
+    // All points identical, more than a leaf can hold.
+    geometry::KDTreeFloat<2> kdtree(MatrixXd::Ones(2, 100), 4);
+    EXPECT_EQ(kdtree.SearchKNN(Vector2d(1.0, 2.0), 150, indices, distance2),
+              100);
+    EXPECT_NEAR(distance2[99], 1.0, THRESHOLD_1E_6);
+    EXPECT_EQ(kdtree.SearchRadius(Vector2d(1.0, 2.0), 1.0, indices,
+                                  distance2),
+              0);
+    EXPECT_EQ(kdtree.SearchHybrid(Vector2d(1.0, 1.5), 1.0, 3, indices,
+                                  distance2),
+              3);
+    EXPECT_EQ(kdtree.SearchHybrid(Vector2d(1.0, 1.5), 1.0, -1, indices,
+                                  distance2),
+              -1);
+}
+
+TEST(KDTreeFloat, RemovePoint) {
+    geometry::PointCloud pc;
+    pc.points_.resize(500);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFloat3D kdtree(pc);
+
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(kdtree.SearchKNN(pc.points_[42], 1, indices, distance2), 1);
+    EXPECT_EQ(indices[0], 42);
+
+    EXPECT_TRUE(kdtree.RemovePoint(42));
+    EXPECT_FALSE(kdtree.RemovePoint(42));
+    EXPECT_FALSE(kdtree.RemovePoint(500));
+    EXPECT_EQ(kdtree.GetRemovedCount(), size_t(1));
+    EXPECT_EQ(kdtree.SearchKNN(pc.points_[42], 10, indices, distance2), 10);
+    EXPECT_TRUE(find(indices.begin(), indices.end(), 42) == indices.end());
+    EXPECT_GT(distance2[0], 0.0);
+}
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(NeighborGraph, Build) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    geometry::NeighborGraph empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_FALSE(empty.Build(geometry::PointCloud(),
+                             geometry::KDTreeSearchParamKNN(10)));
+
+    geometry::NeighborGraph knn_graph(pc, geometry::KDTreeSearchParamKNN(10));
+    EXPECT_EQ(pc.points_.size(), knn_graph.GetNodeCount());
+    EXPECT_EQ(pc.points_.size() * 10, knn_graph.GetEdgeCount());
+    EXPECT_EQ(10, knn_graph.GetMaxNN());
+    EXPECT_EQ(geometry::KDTreeSearchParam::SearchType::Knn,
+              knn_graph.GetSearchType());
+
+    geometry::NeighborGraph radius_graph;
+    EXPECT_TRUE(radius_graph.Build(
+            pc, geometry::KDTreeSearchParamRadius(1.5), kdtree));
+    EXPECT_EQ(pc.points_.size(), radius_graph.GetNodeCount());
+    EXPECT_DOUBLE_EQ(1.5, radius_graph.GetRadius());
+
+    vector<int> ref_indices, indices;
+    vector<double> ref_distance2, distance2;
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        kdtree.SearchKNN(pc.points_[i], 10, ref_indices, ref_distance2);
+        EXPECT_EQ(10, knn_graph.GetNeighbors(i, indices, distance2));
+        EXPECT_EQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2);
+        EXPECT_EQ(int(i), indices[0]);
+
+        kdtree.SearchRadius(pc.points_[i], 1.5, ref_indices, ref_distance2);
+        EXPECT_EQ(int(ref_indices.size()), radius_graph.GetNeighborCount(i));
+    }
+
+    // A KDTree built on another point cloud is rejected.
+    geometry::PointCloud other;
+    other.points_.resize(10);
+    geometry::KDTreeFlann other_kdtree(other);
+    EXPECT_FALSE(radius_graph.Build(pc, geometry::KDTreeSearchParamKNN(10),
+                                    other_kdtree));
+    EXPECT_TRUE(radius_graph.IsEmpty());
+}
+
+TEST(NeighborGraph, PointCloudOperations) {
+    geometry::PointCloud pc;
+    pc.points_.resize(2000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::NeighborGraph knn_graph(pc, geometry::KDTreeSearchParamKNN(20));
+
+    geometry::PointCloud ref_pc = pc;
+    ref_pc.EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    pc.EstimateNormals(knn_graph);
+    ExpectEQ(ref_pc.normals_, pc.normals_);
+
+    auto ref_fpfh = registration::ComputeFPFHFeature(
+            ref_pc, geometry::KDTreeSearchParamKNN(20));
+    auto fpfh = registration::ComputeFPFHFeature(pc, knn_graph);
+    ExpectEQ(ref_fpfh->data_, fpfh->data_);
+
+    auto ref_inliers = get<1>(pc.RemoveStatisticalOutliers(20, 1.0));
+    auto inliers = get<1>(pc.RemoveStatisticalOutliers(knn_graph, 1.0));
+    EXPECT_EQ(ref_inliers, inliers);
+
+    ExpectEQ(pc.ComputeNearestNeighborDistance(),
+             pc.ComputeNearestNeighborDistance(knn_graph));
+
+    geometry::NeighborGraph radius_graph(
+            pc, geometry::KDTreeSearchParamRadius(0.8));
+    EXPECT_EQ(pc.ClusterDBSCAN(0.8, 5), pc.ClusterDBSCAN(radius_graph, 5));
+}
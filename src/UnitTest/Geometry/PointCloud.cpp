@@ -25,12 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <numeric>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/VoxelHashNeighborSearch.h"
 #include "TestUtility/UnitTest.h"
 
 using namespace Eigen;
@@ -527,6 +530,32 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ref_colors, output_pc->colors_);
 }
 
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pc;
+    pc.points_ = {{0.1, 0.1, 0.1}, {0.9, 0.1, 0.1}, {2.6, 0.1, 0.1},
+                  {0.3, 0.8, 0.1}, {2.4, 0.4, 0.6}, {0.6, 0.2, 0.3}};
+    pc.colors_ = {{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}, {3.0, 3.0, 3.0},
+                  {2.0, 2.0, 2.0}, {3.0, 3.0, 3.0}, {2.0, 2.0, 2.0}};
+
+    shared_ptr<geometry::PointCloud> output;
+    MatrixXi cubic_id;
+    vector<vector<int>> original_indices;
+    tie(output, cubic_id, original_indices) = pc.VoxelDownSampleAndTrace(
+            1.0, Vector3d(0.0, 0.0, 0.0), Vector3d(3.0, 1.0, 1.0), true);
+
+    // Voxels are ordered by index and points by input order within a voxel.
+    ExpectEQ(vector<Vector3d>({{0.475, 0.3, 0.15}, {2.5, 0.25, 0.35}}),
+             output->points_);
+    ExpectEQ(vector<Vector3d>({{2.0, 2.0, 2.0}, {3.0, 3.0, 3.0}}),
+             output->colors_);
+    EXPECT_TRUE(original_indices ==
+                vector<vector<int>>({{0, 1, 3, 5}, {2, 4}}));
+    MatrixXi ref_cubic_id(2, 8);
+    ref_cubic_id << 0, 5, 3, -1, -1, -1, -1, -1,  //
+            -1, 2, -1, -1, 4, -1, -1, -1;
+    EXPECT_EQ(ref_cubic_id, cubic_id);
+}
+
 TEST(PointCloud, UniformDownSample) {
     vector<Vector3d> ref = {{839.215686, 392.156863, 780.392157},
                             {364.705882, 509.803922, 949.019608},
@@ -588,6 +617,84 @@ TEST(PointCloud, CropPointCloud) {
     ExpectGE(maxBound, output_pc->points_);
 }
 
+TEST(PointCloud, RemoveRadiusOutliers) {
+    geometry::PointCloud pc;
+    pc.points_.resize(2000);
+    Rand(pc.points_, Zero3d, Vector3d(10.0, 10.0, 10.0), 0);
+    const size_t nb_points = 3;
+    const double radius = 1.0;
+
+    vector<size_t> ref_indices;
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        size_t count = 0;
+        for (const Vector3d &point : pc.points_) {
+            count += (point - pc.points_[i]).squaredNorm() < radius * radius;
+        }
+        if (count > nb_points) {
+            ref_indices.push_back(i);
+        }
+    }
+    ASSERT_LT(ref_indices.size(), pc.points_.size());
+
+    vector<size_t> indices;
+    tie(ignore, indices) = pc.RemoveRadiusOutliers(nb_points, radius);
+    EXPECT_EQ(ref_indices, indices);
+
+    geometry::KDTreeFlann kdtree(pc);
+    tie(ignore, indices) = pc.RemoveRadiusOutliers(nb_points, radius, kdtree);
+    EXPECT_EQ(ref_indices, indices);
+
+    geometry::PointCloud other;
+    other.points_.resize(10);
+    EXPECT_ANY_THROW(other.RemoveRadiusOutliers(nb_points, radius, kdtree));
+}
+
+TEST(PointCloud, RemoveStatisticalOutliers) {
+    geometry::PointCloud pc;
+    pc.points_.resize(2000);
+    Rand(pc.points_, Zero3d, Vector3d(10.0, 10.0, 10.0), 0);
+    const size_t nb_neighbors = 10;
+    const double std_ratio = 1.0;
+
+    vector<double> avg_distances;
+    for (const Vector3d &query : pc.points_) {
+        vector<double> distances;
+        for (const Vector3d &point : pc.points_) {
+            distances.push_back((point - query).norm());
+        }
+        sort(distances.begin(), distances.end());
+        avg_distances.push_back(
+                accumulate(distances.begin(),
+                           distances.begin() + nb_neighbors, 0.0) /
+                nb_neighbors);
+    }
+    double mean = accumulate(avg_distances.begin(), avg_distances.end(), 0.0) /
+                  avg_distances.size();
+    double sq_sum = 0.0;
+    for (double avg_distance : avg_distances) {
+        sq_sum += (avg_distance - mean) * (avg_distance - mean);
+    }
+    double threshold =
+            mean + std_ratio * sqrt(sq_sum / (avg_distances.size() - 1));
+    vector<size_t> ref_indices;
+    for (size_t i = 0; i < avg_distances.size(); i++) {
+        if (avg_distances[i] < threshold) {
+            ref_indices.push_back(i);
+        }
+    }
+    ASSERT_LT(ref_indices.size(), pc.points_.size());
+
+    vector<size_t> indices;
+    tie(ignore, indices) =
+            pc.RemoveStatisticalOutliers(nb_neighbors, std_ratio);
+    EXPECT_EQ(ref_indices, indices);
+
+    geometry::KDTreeFlann kdtree(pc);
+    tie(ignore, indices) =
+            pc.RemoveStatisticalOutliers(nb_neighbors, std_ratio, kdtree);
+    EXPECT_EQ(ref_indices, indices);
+}
+
 TEST(PointCloud, EstimateNormals) {
     vector<Vector3d> ref = {
             {0.282003, 0.866394, 0.412111},   {0.550791, 0.829572, -0.091869},
@@ -1078,3 +1185,141 @@ TEST(PointCloud, SegmentPlane) {
 
     ExpectEQ(ref, output_pc->points_);
 }
+
+// Reference DBSCAN: sequential cluster expansion with brute-force neighbors.
+static vector<int> ClusterDBSCANReference(const vector<Vector3d> &points,
+                                          double eps,
+                                          size_t min_points,
+                                          int &num_clusters) {
+    const int num_points = int(points.size());
+    vector<vector<int>> nbs(num_points);
+    for (int i = 0; i < num_points; i++) {
+        for (int j = 0; j < num_points; j++) {
+            if ((points[i] - points[j]).squaredNorm() < eps * eps) {
+                nbs[i].push_back(j);
+            }
+        }
+    }
+    vector<int> ref_labels(num_points, -2);
+    num_clusters = 0;
+    for (int i = 0; i < num_points; i++) {
+        if (ref_labels[i] != -2) {
+            continue;
+        }
+        if (nbs[i].size() < min_points) {
+            ref_labels[i] = -1;
+            continue;
+        }
+        vector<int> queue(1, i);
+        while (!queue.empty()) {
+            int nb = queue.back();
+            queue.pop_back();
+            if (ref_labels[nb] == -1) {
+                ref_labels[nb] = num_clusters;
+            }
+            if (ref_labels[nb] != -2) {
+                continue;
+            }
+            ref_labels[nb] = num_clusters;
+            if (nbs[nb].size() >= min_points) {
+                queue.insert(queue.end(), nbs[nb].begin(), nbs[nb].end());
+            }
+        }
+        num_clusters++;
+    }
+    return ref_labels;
+}
+
+TEST(PointCloud, ClusterDBSCAN) {
+    // Three blobs of different density with uniform noise around.
+    geometry::PointCloud pc;
+    vector<Vector3d> blob(300);
+    Rand(blob, Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0), 0);
+    pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    Rand(blob, Vector3d(2.0, 0.0, 0.0), Vector3d(2.5, 0.5, 0.5), 1);
+    pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    Rand(blob, Vector3d(0.0, 3.0, 0.0), Vector3d(2.0, 5.0, 2.0), 2);
+    pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    vector<Vector3d> noise(200);
+    Rand(noise, Vector3d(-2.0, -2.0, -2.0), Vector3d(6.0, 6.0, 6.0), 3);
+    pc.points_.insert(pc.points_.end(), noise.begin(), noise.end());
+
+    const double eps = 0.2;
+    const size_t min_points = 5;
+
+    int num_clusters = 0;
+    vector<int> ref_labels =
+            ClusterDBSCANReference(pc.points_, eps, min_points, num_clusters);
+    EXPECT_GE(num_clusters, 3);
+
+    vector<int> labels = pc.ClusterDBSCAN(eps, min_points);
+    ExpectEQ(ref_labels, labels);
+
+    EXPECT_TRUE(geometry::PointCloud().ClusterDBSCAN(eps, 1).empty());
+}
+
+TEST(PointCloud, ClusterDBSCANFallback) {
+    // UTM-like coordinates, too large for a hash grid with millimeter cells.
+    geometry::PointCloud pc;
+    vector<Vector3d> blob(200);
+    Rand(blob, Vector3d(500000.0, 5000000.0, 100.0),
+         Vector3d(500000.01, 5000000.01, 100.01), 0);
+    pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    Rand(blob, Vector3d(500000.03, 5000000.0, 100.0),
+         Vector3d(500000.04, 5000000.01, 100.01), 1);
+    pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+
+    const double eps = 0.001;
+    const size_t min_points = 3;
+    EXPECT_FALSE(geometry::VoxelHashNeighborSearch::CanIndex(pc.points_, eps));
+    int num_clusters = 0;
+    vector<int> ref_labels =
+            ClusterDBSCANReference(pc.points_, eps, min_points, num_clusters);
+    EXPECT_GE(num_clusters, 2);
+    ExpectEQ(ref_labels, pc.ClusterDBSCAN(eps, min_points));
+
+    // All points are noise for a non-positive eps.
+    const vector<int> noise(pc.points_.size(), -1);
+    ExpectEQ(noise, pc.ClusterDBSCAN(0.0, 1));
+    ExpectEQ(noise, pc.ClusterDBSCAN(-1.0, 1));
+}
+
+TEST(PointCloud, SegmentPlanes) {
+    // Three axis-aligned planes of decreasing size and some noise.
+    geometry::PointCloud pc;
+    vector<Vector3d> points(6000);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 0.0), 0);
+    pc.points_.insert(pc.points_.end(), points.begin(), points.end());
+    points.resize(3000);
+    Rand(points, Vector3d(0.0, 20.0, 1.0), Vector3d(10.0, 20.0, 10.0), 1);
+    pc.points_.insert(pc.points_.end(), points.begin(), points.end());
+    points.resize(1500);
+    Rand(points, Vector3d(20.0, 0.0, 1.0), Vector3d(20.0, 10.0, 10.0), 2);
+    pc.points_.insert(pc.points_.end(), points.begin(), points.end());
+    points.resize(100);
+    Rand(points, Vector3d(30.0, 30.0, 30.0), Vector3d(40.0, 40.0, 40.0), 3);
+    pc.points_.insert(pc.points_.end(), points.begin(), points.end());
+
+    auto planes = pc.SegmentPlanes(5, 500, 0.01, 3, 1000);
+    ASSERT_EQ(3u, planes.size());
+
+    const vector<Vector3d> ref_normals = {
+            {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}};
+    const vector<size_t> ref_begins = {0, 6000, 9000};
+    const vector<size_t> ref_sizes = {6000, 3000, 1500};
+    for (size_t i = 0; i < planes.size(); i++) {
+        Vector4d plane_model = get<0>(planes[i]);
+        const vector<size_t> &inliers = get<1>(planes[i]);
+        EXPECT_NEAR(1.0, std::abs(plane_model.head<3>().dot(ref_normals[i])),
+                    THRESHOLD_1E_6);
+        ASSERT_EQ(ref_sizes[i], inliers.size());
+        EXPECT_EQ(ref_begins[i], inliers.front());
+        EXPECT_EQ(ref_begins[i] + ref_sizes[i] - 1, inliers.back());
+    }
+
+    // Single plane, found early by the adaptive iteration count.
+    Vector4d plane_model;
+    vector<size_t> inliers;
+    tie(plane_model, inliers) = pc.SegmentPlane(0.01, 3, 100000);
+    EXPECT_EQ(6000u, inliers.size());
+}
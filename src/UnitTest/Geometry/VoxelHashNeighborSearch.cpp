@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/VoxelHashNeighborSearch.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Sorts the neighbors of a query by index.
+vector<pair<int, double>> SortedByIndex(const vector<int> &indices,
+                                        const vector<double> &distance2) {
+    vector<pair<int, double>> neighbors;
+    for (size_t i = 0; i < indices.size(); i++) {
+        neighbors.emplace_back(indices[i], distance2[i]);
+    }
+    sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+}  // unnamed namespace
+
+TEST(VoxelHashNeighborSearch, SearchRadius) {
+    vector<Vector3d> points(2000);
+    Rand(points, Vector3d(-5.0, -5.0, -5.0), Vector3d(5.0, 5.0, 5.0), 0);
+    vector<Vector3d> queries(100);
+    Rand(queries, Vector3d(-6.0, -6.0, -6.0), Vector3d(6.0, 6.0, 6.0), 1);
+
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetMatrixData(Map<const MatrixXd>(points[0].data(), 3,
+                                             int(points.size())));
+    geometry::VoxelHashNeighborSearch grid(points, 1.0);
+    EXPECT_EQ(points.size(), grid.GetDataSize());
+    EXPECT_DOUBLE_EQ(1.0, grid.GetCellSize());
+
+    vector<int> ref_indices, indices;
+    vector<double> ref_distance2, distance2;
+    // Radius below, equal to and above the cell size.
+    for (double radius : {0.6, 1.0, 2.3}) {
+        for (const Vector3d &query : queries) {
+            int ref_k = kdtree.SearchRadius(query, radius, ref_indices,
+                                            ref_distance2);
+            int k = grid.SearchRadius(query, radius, indices, distance2);
+            EXPECT_EQ(ref_k, k);
+            auto ref = SortedByIndex(ref_indices, ref_distance2);
+            auto result = SortedByIndex(indices, distance2);
+            ASSERT_EQ(ref.size(), result.size());
+            for (size_t i = 0; i < ref.size(); i++) {
+                EXPECT_EQ(ref[i].first, result[i].first);
+                EXPECT_NEAR(ref[i].second, result[i].second, THRESHOLD_1E_6);
+            }
+        }
+    }
+}
+
+TEST(VoxelHashNeighborSearch, SearchHybrid) {
+    vector<Vector3d> points(2000);
+    Rand(points, Vector3d(-5.0, -5.0, -5.0), Vector3d(5.0, 5.0, 5.0), 0);
+    vector<Vector3d> queries(100);
+    Rand(queries, Vector3d(-5.0, -5.0, -5.0), Vector3d(5.0, 5.0, 5.0), 1);
+
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetMatrixData(Map<const MatrixXd>(points[0].data(), 3,
+                                             int(points.size())));
+    geometry::VoxelHashNeighborSearch grid(points, 1.0);
+
+    vector<int> ref_indices, indices;
+    vector<double> ref_distance2, distance2;
+    for (const Vector3d &query : queries) {
+        int ref_k = kdtree.SearchHybrid(query, 1.0, 10, ref_indices,
+                                        ref_distance2);
+        int k = grid.SearchHybrid(query, 1.0, 10, indices, distance2);
+        EXPECT_EQ(ref_k, k);
+        ExpectEQ(ref_distance2, distance2);
+        EXPECT_TRUE(is_sorted(distance2.begin(), distance2.end()));
+    }
+}
+
+TEST(VoxelHashNeighborSearch, SearchRadiusBatchAndAll) {
+    vector<Vector3d> points(3000);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 2.0), 2);
+    geometry::VoxelHashNeighborSearch grid(points, 0.5);
+    const double radius = 0.5;
+
+    vector<int> batch_indices, all_indices, indices;
+    vector<double> batch_distance2, all_distance2, distance2;
+    vector<size_t> batch_offsets, all_offsets;
+    EXPECT_TRUE(grid.SearchRadiusBatch(points, radius, batch_indices,
+                                       batch_distance2, batch_offsets));
+    EXPECT_TRUE(grid.SearchRadiusAll(radius, all_indices, all_distance2,
+                                     all_offsets));
+    ASSERT_EQ(points.size() + 1, batch_offsets.size());
+    ASSERT_EQ(points.size() + 1, all_offsets.size());
+    EXPECT_EQ(batch_indices.size(), batch_offsets.back());
+    EXPECT_EQ(all_indices.size(), all_offsets.back());
+
+    for (size_t i = 0; i < points.size(); i++) {
+        grid.SearchRadius(points[i], radius, indices, distance2);
+        auto ref = SortedByIndex(indices, distance2);
+        vector<int> batch(batch_indices.begin() + batch_offsets[i],
+                          batch_indices.begin() + batch_offsets[i + 1]);
+        vector<double> batch_d2(batch_distance2.begin() + batch_offsets[i],
+                                batch_distance2.begin() + batch_offsets[i + 1]);
+        vector<int> all(all_indices.begin() + all_offsets[i],
+                        all_indices.begin() + all_offsets[i + 1]);
+        vector<double> all_d2(all_distance2.begin() + all_offsets[i],
+                              all_distance2.begin() + all_offsets[i + 1]);
+        EXPECT_TRUE(ref == SortedByIndex(batch, batch_d2));
+        EXPECT_TRUE(ref == SortedByIndex(all, all_d2));
+        EXPECT_NE(all.end(), find(all.begin(), all.end(), int(i)));
+    }
+}
+
+TEST(VoxelHashNeighborSearch, InvalidInput) {
+    geometry::VoxelHashNeighborSearch grid(1.0);
+    vector<int> indices;
+    vector<double> distance2;
+    vector<size_t> offsets;
+    EXPECT_FALSE(grid.SetPoints(vector<Vector3d>()));
+    EXPECT_EQ(-1, grid.SearchRadius(Vector3d::Zero(), 1.0, indices,
+                                    distance2));
+    EXPECT_FALSE(grid.SearchRadiusAll(1.0, indices, distance2, offsets));
+
+    EXPECT_TRUE(grid.SetPoints({Vector3d::Zero(), Vector3d(1.2, 0.0, 0.0)}));
+    EXPECT_EQ(2u, grid.GetCellCount());
+    EXPECT_EQ(-1, grid.SearchRadius(Vector3d::Zero(), 0.0, indices,
+                                    distance2));
+    EXPECT_EQ(2, grid.SearchRadius(Vector3d(0.6, 0.0, 0.0), 1.0, indices,
+                                   distance2));
+    EXPECT_EQ(-1, grid.SearchHybrid(Vector3d::Zero(), 1.0, -1, indices,
+                                    distance2));
+}
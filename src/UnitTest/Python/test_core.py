@@ -183,6 +183,24 @@ def test_tensor_constructor():
     np.testing.assert_equal(np_t, o3_t.numpy())
 
 
+@pytest.mark.parametrize("np_dtype, dtype",
+                         [(np.float16, o3d.Dtype.Float16),
+                          (np.int16, o3d.Dtype.Int16),
+                          (np.uint16, o3d.Dtype.UInt16)])
+def test_tensor_constructor_16bit(np_dtype, dtype):
+    np_t = np.array([[0, 1, 2], [3, 4, 5]], dtype=np_dtype)
+
+    # The dtype is deduced from the Numpy array
+    o3_t = o3d.Tensor(np_t)
+    assert o3_t.dtype == dtype
+    assert o3_t.numpy().dtype == np_dtype
+    np.testing.assert_equal(np_t, o3_t.numpy())
+
+    o3_t = o3d.Tensor.from_numpy(np_t)
+    assert o3_t.dtype == dtype
+    np.testing.assert_equal(np_t, o3_t.numpy())
+
+
 def test_tensor_from_to_numpy():
     # a->b copy; b, c share memory
     a = np.ones((2, 2))
@@ -642,6 +660,24 @@ def test_advanced_index_set_mixed():
     np.testing.assert_equal(o3_src.numpy(), np_src)
 
 
+def test_boolean_mask_indexing():
+    np_src = np.array(range(24)).reshape((8, 3))
+    o3_src = o3d.Tensor(np_src)
+    np_mask = np_src[:, 0] % 2 == 0
+
+    np.testing.assert_equal(o3_src.nonzero().numpy(),
+                            np.stack(np_src.nonzero()))
+    np.testing.assert_equal(o3_src[np_mask].numpy(), np_src[np_mask])
+    np.testing.assert_equal(o3_src[np_src > 10].numpy(), np_src[np_src > 10])
+    o3_index = o3_src[:, 0].nonzero(as_tuple=True)
+    np.testing.assert_equal(o3_src[o3_index].numpy(),
+                            np_src[np_src[:, 0].nonzero()])
+
+    np_src[np_src > 10] = 0
+    o3_src[o3_src.numpy() > 10] = o3d.Tensor(np.array([0]))
+    np.testing.assert_equal(o3_src.numpy(), np_src)
+
+
 def test_tensorlist_indexing():
     # 5 x (3, 4)
     dtype = o3d.Dtype.Float32
@@ -24,8 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/Feature.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Feature, DISABLED_Resize) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_Dimension) { unit_test::NotImplemented(); }
@@ -35,3 +38,42 @@ TEST(Feature, DISABLED_Num) { unit_test::NotImplemented(); }
 TEST(Feature, DISABLED_ComputeFPFHFeature) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { unit_test::NotImplemented(); }
+
+TEST(Feature, CorrespondencesFromFeatures) {
+    // Target features are a noisy permutation of the source features, plus
+    // extra features that are far from all of them.
+    registration::Feature source, target;
+    source.data_ = Eigen::MatrixXd::Random(33, 300);
+    target.data_ = Eigen::MatrixXd::Random(33, 400).array() + 10.0;
+    std::vector<int> permutation(300);
+    for (int i = 0; i < 300; i++) {
+        permutation[i] = (i * 7) % 300;
+        target.data_.col(permutation[i]) =
+                source.data_.col(i) +
+                0.001 * Eigen::VectorXd::Random(33);
+    }
+
+    registration::CorrespondenceSet corres =
+            registration::CorrespondencesFromFeatures(source, target);
+    ASSERT_EQ(corres.size(), size_t(300));
+    for (int i = 0; i < 300; i++) {
+        EXPECT_EQ(corres[i](0), i);
+        EXPECT_EQ(corres[i](1), permutation[i]);
+    }
+
+    // Source features matched by nothing are dropped by the mutual filter.
+    source.data_.col(5) = source.data_.col(6);
+    corres = registration::CorrespondencesFromFeatures(source, target, true);
+    EXPECT_EQ(corres.size(), size_t(299));
+
+    // The approximate index finds almost all of the matches.
+    corres = registration::CorrespondencesFromFeatures(
+            source, target, false, geometry::KDTreeIndexParam(4, 256));
+    int num_correct = 0;
+    for (const Eigen::Vector2i &c : corres) {
+        if (c(1) == permutation[c(0)]) {
+            num_correct++;
+        }
+    }
+    EXPECT_GE(num_correct, 270);
+}
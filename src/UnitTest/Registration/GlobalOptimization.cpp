@@ -24,14 +24,79 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Ring of num_nodes poses with exact odometry and loop closure edges.
+vector<Matrix4d, utility::Matrix4d_allocator> CreateRingPoseGraph(
+        int num_nodes, registration::PoseGraph &pose_graph) {
+    vector<Matrix4d, utility::Matrix4d_allocator> poses;
+    for (int i = 0; i < num_nodes; i++) {
+        double angle = 2.0 * M_PI * i / num_nodes;
+        Vector6d pose;
+        pose << 0.1 * sin(angle), 0.05 * cos(angle), angle, 5.0 * cos(angle),
+                5.0 * sin(angle), 0.2 * sin(2.0 * angle);
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose));
+    }
+    Matrix6d information = Matrix6d::Identity() * 1000.0;
+    auto add_edge = [&](int source, int target, bool uncertain) {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                source, target, poses[target].inverse() * poses[source],
+                information, uncertain));
+    };
+    for (int i = 0; i < num_nodes; i++) {
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(poses[i]));
+        if (i > 0) {
+            add_edge(i - 1, i, false);
+        }
+    }
+    for (int i = 0; i + 5 < num_nodes; i += 5) {
+        add_edge(i, i + 5, true);
+    }
+    add_edge(num_nodes - 1, 0, true);
+    return poses;
+}
+
+}  // unnamed namespace
+
 TEST(GlobalOptimization, DISABLED_Constructor) { unit_test::NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    unit_test::NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    registration::PoseGraph pose_graph;
+    auto poses = CreateRingPoseGraph(40, pose_graph);
+
+    // Perturbs all the poses but the reference one.
+    for (size_t i = 1; i < pose_graph.nodes_.size(); i++) {
+        Vector6d noise;
+        Rand(noise.data(), 6, -0.02, 0.02, int(i));
+        pose_graph.nodes_[i].pose_ =
+                utility::TransformVector6dToMatrix4d(noise) *
+                pose_graph.nodes_[i].pose_;
+    }
+    registration::GlobalOptimizationConvergenceCriteria criteria;
+    registration::GlobalOptimizationOption option(0.03, 0.25, 1.0, 0);
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            criteria, option);
+
+    EXPECT_EQ(poses.size(), pose_graph.nodes_.size());
+    EXPECT_EQ(poses.size() + 7, pose_graph.edges_.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        ExpectEQ(poses[i], Matrix4d(pose_graph.nodes_[i].pose_), 1e-4);
+    }
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -24,8 +24,37 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Smooth height field sampled on a regular grid.
+geometry::PointCloud CreateHeightFieldPointCloud(int size, double step) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            double x = i * step;
+            double y = j * step;
+            pcd.points_.push_back(
+                    Vector3d(x, y, 0.2 * sin(6.0 * x) * cos(5.0 * y)));
+        }
+    }
+    pcd.EstimateNormals();
+    return pcd;
+}
+
+}  // unnamed namespace
+
 TEST(Registration, DISABLED_ICPConvergenceCriteria) {
     unit_test::NotImplemented();
 }
@@ -48,6 +77,42 @@ TEST(Registration, DISABLED_EvaluateRegistration) {
 
 TEST(Registration, DISABLED_RegistrationICP) { unit_test::NotImplemented(); }
 
+TEST(Registration, RegistrationMultiScaleICP) {
+    geometry::PointCloud target = CreateHeightFieldPointCloud(100, 0.01);
+    Vector6d pose;
+    pose << 0.03, -0.02, 0.05, 0.04, -0.03, 0.02;
+    Matrix4d ref_transformation = utility::TransformVector6dToMatrix4d(pose);
+    geometry::PointCloud source = target;
+    source.Transform(ref_transformation.inverse());
+
+    vector<double> voxel_sizes = {0.04, 0.02, 0.0};
+    vector<double> max_correspondence_distances = {0.2, 0.1, 0.05};
+    vector<registration::ICPConvergenceCriteria> criterias(
+            3, registration::ICPConvergenceCriteria(1e-6, 1e-6, 100));
+    registration::RegistrationResult result =
+            registration::RegistrationMultiScaleICP(
+                    source, target, voxel_sizes, max_correspondence_distances,
+                    criterias, Matrix4d::Identity(),
+                    registration::TransformationEstimationPointToPlane());
+    ExpectEQ(ref_transformation, Matrix4d(result.transformation_), 1e-4);
+    EXPECT_NEAR(1.0, result.fitness_, 1e-12);
+    EXPECT_NEAR(0.0, result.inlier_rmse_, 1e-4);
+
+    // A single level without downsampling is plain ICP.
+    Matrix4d init = utility::TransformVector6dToMatrix4d(0.5 * pose);
+    registration::RegistrationResult ref_result =
+            registration::RegistrationICP(source, target, 0.1, init);
+    result = registration::RegistrationMultiScaleICP(
+            source, target, {0.0}, {0.1},
+            {registration::ICPConvergenceCriteria()}, init);
+    ExpectEQ(Matrix4d(ref_result.transformation_),
+             Matrix4d(result.transformation_));
+    EXPECT_EQ(ref_result.correspondence_set_.size(),
+              result.correspondence_set_.size());
+    EXPECT_EQ(ref_result.fitness_, result.fitness_);
+    EXPECT_EQ(ref_result.inlier_rmse_, result.inlier_rmse_);
+}
+
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     unit_test::NotImplemented();
 }
@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <memory>
+
+#include "Open3D/Registration/RobustKernel.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(RobustKernel, Weight) {
+    registration::L2Loss l2_loss;
+    EXPECT_EQ(1.0, l2_loss.Weight(0.0));
+    EXPECT_EQ(1.0, l2_loss.Weight(-5.0));
+
+    registration::HuberLoss huber_loss(0.5);
+    EXPECT_EQ(1.0, huber_loss.Weight(0.0));
+    EXPECT_EQ(1.0, huber_loss.Weight(-0.5));
+    EXPECT_NEAR(0.25, huber_loss.Weight(2.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.25, huber_loss.Weight(-2.0), THRESHOLD_1E_6);
+
+    registration::CauchyLoss cauchy_loss(0.5);
+    EXPECT_EQ(1.0, cauchy_loss.Weight(0.0));
+    EXPECT_NEAR(0.5, cauchy_loss.Weight(0.5), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.2, cauchy_loss.Weight(-1.0), THRESHOLD_1E_6);
+
+    registration::GMLoss gm_loss(0.5);
+    EXPECT_EQ(1.0, gm_loss.Weight(0.0));
+    EXPECT_NEAR(0.25, gm_loss.Weight(0.5), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.04, gm_loss.Weight(-1.0), THRESHOLD_1E_6);
+
+    registration::TukeyLoss tukey_loss(0.5);
+    EXPECT_EQ(1.0, tukey_loss.Weight(0.0));
+    EXPECT_NEAR(0.5625, tukey_loss.Weight(-0.25), THRESHOLD_1E_6);
+    EXPECT_EQ(0.0, tukey_loss.Weight(0.5));
+    EXPECT_EQ(0.0, tukey_loss.Weight(2.0));
+}
+
+TEST(RobustKernel, InvalidParameters) {
+    EXPECT_THROW(registration::HuberLoss(0.0), std::runtime_error);
+    EXPECT_THROW(registration::CauchyLoss(-1.0), std::runtime_error);
+    EXPECT_THROW(registration::GMLoss(0.0), std::runtime_error);
+    EXPECT_THROW(registration::TukeyLoss(-0.5), std::runtime_error);
+    EXPECT_THROW(registration::TransformationEstimationPointToPlane(
+                         std::shared_ptr<registration::RobustKernel>()),
+                 std::runtime_error);
+}
@@ -24,8 +24,20 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+#include <memory>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/RobustKernel.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
 TEST(TransformationEstimation, DISABLED_Constructor) {
     unit_test::NotImplemented();
 }
@@ -57,3 +69,60 @@ TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPoint) {
 TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPlane) {
     unit_test::NotImplemented();
 }
+
+TEST(TransformationEstimation, TransformationEstimationPointToPlaneRobust) {
+    geometry::PointCloud target;
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            double x = i * 0.02;
+            double y = j * 0.02;
+            target.points_.push_back(
+                    Vector3d(x, y, 0.2 * sin(6.0 * x) * cos(5.0 * y)));
+        }
+    }
+    target.EstimateNormals();
+    Vector6d pose;
+    pose << 0.02, -0.01, 0.03, 0.01, -0.02, 0.01;
+    Matrix4d ref_transformation = utility::TransformVector6dToMatrix4d(pose);
+    geometry::PointCloud source = target;
+    source.Transform(ref_transformation.inverse());
+
+    // One source point in ten is an outlier.
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < (int)source.points_.size(); i++) {
+        if (i % 10 == 0) {
+            source.points_[i](2) += 0.5;
+        }
+        corres.push_back(Vector2i(i, i));
+    }
+
+    auto run_irls = [&](const registration::TransformationEstimation &te) {
+        geometry::PointCloud pcd = source;
+        Matrix4d transformation = Matrix4d::Identity();
+        for (int i = 0; i < 30; i++) {
+            Matrix4d update = te.ComputeTransformation(pcd, target, corres);
+            transformation = update * transformation;
+            pcd.Transform(update);
+        }
+        return transformation;
+    };
+
+    Matrix4d l2_transformation =
+            run_irls(registration::TransformationEstimationPointToPlane());
+    EXPECT_GT((l2_transformation - ref_transformation).norm(), 1e-3);
+
+    vector<shared_ptr<registration::RobustKernel>> kernels = {
+            make_shared<registration::HuberLoss>(0.01),
+            make_shared<registration::CauchyLoss>(0.01),
+            make_shared<registration::GMLoss>(0.01),
+            make_shared<registration::TukeyLoss>(0.05)};
+    for (const auto &kernel : kernels) {
+        Matrix4d transformation = run_irls(
+                registration::TransformationEstimationPointToPlane(kernel));
+        EXPECT_LT((transformation - ref_transformation).norm(),
+                  (l2_transformation - ref_transformation).norm());
+    }
+    Matrix4d tukey_transformation = run_irls(
+            registration::TransformationEstimationPointToPlane(kernels[3]));
+    ExpectEQ(ref_transformation, tukey_transformation, 1e-6);
+}
@@ -257,3 +257,50 @@ TEST(Eigen, ComputeJTJandJTr_vector) {
     ExpectEQ(ref_JTr, JTr);
     ExpectEQ(ref_JTJ, JTJ);
 }
+
+TEST(Eigen, ComputeJTJandJTrBlock) {
+    auto testFunction = [&](int i, Vector6d &J_r, double &r) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            vector<double> v(6);
+            Rand(v, -1.0, 1.0, i);
+
+            for (int k = 0; k < 6; k++) J_r(k) = v[k];
+
+            r = (double)(i % 6) / 6;
+        }
+    };
+    auto testBlockFunction = [&](int begin, int end,
+                                 Matrix<double, Dynamic, 6> &J, VectorXd &r) {
+        EXPECT_EQ(end - begin, J.rows());
+        EXPECT_EQ(end - begin, r.size());
+        for (int i = begin; i < end; i++) {
+            Vector6d J_r;
+            testFunction(i, J_r, r(i - begin));
+            J.row(i - begin) = J_r.transpose();
+        }
+    };
+
+    int iteration_num = 100;
+
+    Matrix6d ref_JTJ, JTJ;
+    Vector6d ref_JTr, JTr;
+    double ref_r2, r2;
+
+    // Goes through the std::function overload.
+    function<void(int, Vector6d &, double &)> f = testFunction;
+    tie(ref_JTJ, ref_JTr, ref_r2) =
+            utility::ComputeJTJandJTr<Matrix6d, Vector6d>(f, iteration_num);
+
+    // Block sizes dividing and not dividing the number of rows.
+    for (int block_size : {1, 7, 25, 256}) {
+        tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTrBlock<Matrix6d, Vector6d>(
+                        testBlockFunction, iteration_num, block_size);
+        ExpectEQ(ref_JTJ, JTJ);
+        ExpectEQ(ref_JTr, JTr);
+        EXPECT_NEAR(ref_r2, r2, THRESHOLD_1E_6);
+    }
+}
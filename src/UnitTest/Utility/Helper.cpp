@@ -24,6 +24,33 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <numeric>
+
+#include "Open3D/Utility/Helper.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Helper, DISABLED_SplitString) { unit_test::NotImplemented(); }
+
+TEST(Helper, RadixSortKeys) {
+    // More keys than one sort chunk, with ties to check stability.
+    std::vector<uint64_t> keys(100000);
+    for (size_t i = 0; i < keys.size(); i++) {
+        keys[i] = (i * 2654435761u) % 5000;
+    }
+    keys[7] = (uint64_t(1) << 40) + 3;
+    std::vector<uint64_t> input = keys;
+    std::vector<int> order;
+    utility::RadixSortKeys(keys, uint64_t(1) << 41, order);
+
+    std::vector<int> ref_order(input.size());
+    std::iota(ref_order.begin(), ref_order.end(), 0);
+    std::stable_sort(ref_order.begin(), ref_order.end(),
+                     [&](int a, int b) { return input[a] < input[b]; });
+    EXPECT_EQ(ref_order, order);
+    for (size_t i = 0; i < keys.size(); i++) {
+        EXPECT_EQ(input[order[i]], keys[i]);
+    }
+}